@@ -0,0 +1,159 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* Copyright © 2024      GSI Helmholtzzentrum fuer Schwerionenforschung GmbH
+ *                       Matthias Kretz <m.kretz@gsi.de>
+ */
+// expensive: * [1-9] * *
+#include "bits/main.h"
+
+#include <utility>
+
+#include <vir/aosoa_vector.h>
+#include <vir/simd_execution.h>
+
+template <typename T>
+  struct Vec3
+  {
+    T x, y, z;
+  };
+
+template <typename T>
+  struct Particle
+  {
+    Vec3<T> pos;
+    Vec3<T> vel;
+    T m;
+  };
+
+#if VIR_HAVE_AOSOA_VECTOR
+using float_particles = vir::aosoa_vector<Particle<float>>;
+static_assert(std::random_access_iterator<float_particles::iterator>);
+static_assert(std::random_access_iterator<float_particles::const_iterator>);
+static_assert(std::indirectly_writable<float_particles::iterator, Particle<float>>);
+static_assert(not std::indirectly_writable<float_particles::const_iterator, Particle<float>>);
+static_assert(std::ranges::sized_range<float_particles>);
+static_assert(std::same_as<float_particles::block_type, vir::simdize<Particle<float>>>);
+static_assert(std::same_as<vir::aosoa_vector<Vec3<float>, 3>::block_type,
+			   vir::simdize<Vec3<float>, 3>>);
+#endif
+
+template <typename T>
+  Particle<T>
+  make_particle(std::size_t i)
+  {
+    const T a = T(i % 7);
+    return {{a, T(1), T(2)}, {T(3), T(4), T(5)}, T(a + 1)};
+  }
+
+template <typename V>
+  void
+  test()
+  {
+#if VIR_HAVE_AOSOA_VECTOR
+    using T = typename V::value_type;
+    constexpr int N = V::size();
+    using P = Particle<T>;
+    using AoSoA = vir::aosoa_vector<P, N>;
+
+    AoSoA data;
+    VERIFY(data.empty());
+    const std::size_t n = N * 3 + 1;
+    for (std::size_t i = 0; i < n; ++i)
+      data.push_back(make_particle<T>(i));
+    COMPARE(data.size(), n);
+    VERIFY(data.capacity() >= n);
+    COMPARE(data.capacity() % AoSoA::block_size, 0u);
+    COMPARE(data.block_count(), 4u);
+    COMPARE(data.blocks().size(), 4u);
+    for (std::size_t i = 0; i < n; ++i)
+      {
+	const P p = data[i];
+	COMPARE(p.pos.x, T(i % 7)) << "i = " << i;
+	COMPARE(p.vel.z, T(5)) << "i = " << i;
+	COMPARE(p.m, T(i % 7 + 1)) << "i = " << i;
+      }
+
+    // proxy references
+    data[2] = data[1];
+    COMPARE(P(data[2]).pos.x, T(1));
+    COMPARE(P(data[2]).m, T(2));
+    data[2] = make_particle<T>(2);
+
+    // blocks are simdize<P, N>
+    for (std::size_t b = 0; b < data.block_count(); ++b)
+      {
+	const vir::simdize<P, N>& p = data.block(b);
+	for (int k = 0; k < N and b * N + k < n; ++k)
+	  {
+	    const std::size_t i = b * N + k;
+	    COMPARE(vir::get<0>(p).x[k], T(i % 7)) << "i = " << i;
+	    COMPARE(vir::get<2>(p)[k], T(i % 7 + 1)) << "i = " << i;
+	  }
+      }
+    for (auto& p : data.blocks())
+      vir::get<1>(p).x += T(1);
+    for (std::size_t i = 0; i < n; ++i)
+      COMPARE(P(data[i]).vel.x, T(4)) << "i = " << i;
+    for (auto& p : data.blocks())
+      vir::get<1>(p).x -= T(1);
+
+#if VIR_HAVE_SIMD_EXECUTION
+    constexpr auto exec_simd = vir::execution::simd.prefer_size<N>();
+
+    vir::for_each(exec_simd, data, [](auto& p) {
+      auto& [pos, vel, m] = p;
+      pos.x += vel.x;
+      m -= T(1);
+    });
+    for (std::size_t i = 0; i < n; ++i)
+      {
+	const P p = data[i];
+	COMPARE(p.pos.x, T(i % 7 + 3)) << "i = " << i;
+	COMPARE(p.m, T(i % 7)) << "i = " << i;
+      }
+
+    T ref = 0;
+    for (std::size_t i = 0; i < n; ++i)
+      ref += T(i % 7);
+    T sum = vir::transform_reduce(exec_simd, data, T(), std::plus<>(),
+				  [](const auto& p) { return vir::get<2>(p); });
+    COMPARE(sum, ref);
+
+    // chunks that do not start at a block boundary
+    sum = vir::transform_reduce(exec_simd, data.begin() + 1, data.end(), T(), std::plus<>(),
+				[](const auto& p) { return vir::get<2>(p); });
+    COMPARE(sum, ref);
+
+    vir::aosoa_vector<Vec3<T>, N> out(n);
+    vir::transform(exec_simd, data.begin(), data.end(), out.begin(),
+		   [](const auto& p) { return vir::get<1>(p); });
+    for (std::size_t i = 0; i < n; ++i)
+      {
+	const Vec3<T> v = out[i];
+	COMPARE(v.x, T(3)) << "i = " << i;
+	COMPARE(v.y, T(4)) << "i = " << i;
+	COMPARE(v.z, T(5)) << "i = " << i;
+      }
+#endif
+
+    // copy, move, resize
+    AoSoA copy = data;
+    COMPARE(copy.size(), n);
+    COMPARE(P(copy[n - 1]).pos.x, P(data[n - 1]).pos.x);
+    copy.resize(2 * n);
+    COMPARE(copy.size(), 2 * n);
+    COMPARE(P(copy[n]).m, T());
+    COMPARE(P(copy[n - 1]).vel.y, T(4));
+    AoSoA moved = std::move(copy);
+    COMPARE(moved.size(), 2 * n);
+    COMPARE(copy.size(), 0u);
+    moved.pop_back();
+    COMPARE(moved.size(), 2 * n - 1);
+    moved.resize(2 * n + 1, make_particle<T>(3));
+    COMPARE(P(moved[2 * n]).pos.x, T(3));
+    moved.clear();
+    VERIFY(moved.empty());
+    const AoSoA init = {make_particle<T>(4), make_particle<T>(5)};
+    COMPARE(init.size(), 2u);
+    COMPARE(init[1].m, T(6));
+#endif // VIR_HAVE_AOSOA_VECTOR
+  }
@@ -15,7 +15,7 @@
 #include <iomanip>
 #include "ulp.h"
 
-#ifdef _GLIBCXX_SIMD_HAVE_NEON
+#if _GLIBCXX_SIMD_HAVE_NEON
 // work around PR89357:
 #define alignas(...) __attribute__((aligned(__VA_ARGS__)))
 #endif
@@ -287,10 +287,19 @@ namespace vir {
   } // namespace test
 } // namespace vir
 
+#ifdef __FAST_MATH__
+// -ffast-math allows the vector variants of the libm functions (up to 4 ulp)
+// on either side of the comparison
+#define FUZZY_COMPARE(_a, _b)                                                  \
+  ULP_COMPARE(                                                                 \
+    _a, _b,                                                                    \
+    vir::test::_S_fuzzyness<vir::test::value_type_t<decltype(_a)>> + 8)
+#else
 #define FUZZY_COMPARE(_a, _b)                                                  \
   ULP_COMPARE(                                                                 \
     _a, _b,                                                                    \
     vir::test::_S_fuzzyness<vir::test::value_type_t<decltype(_a)>>)
+#endif
 
 template <typename V>
   void
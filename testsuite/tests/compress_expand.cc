@@ -0,0 +1,62 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* Copyright © 2024      GSI Helmholtzzentrum fuer Schwerionenforschung GmbH
+ *                       Matthias Kretz <m.kretz@gsi.de>
+ */
+// expensive: * [1-9] * *
+#include "bits/main.h"
+
+#include <bit>
+#include <vector>
+
+#include <vir/simd_permute.h>
+
+template <typename V>
+  void
+  test()
+  {
+#if VIR_HAVE_SIMD_PERMUTE
+    using T = typename V::value_type;
+    using M = typename V::mask_type;
+    constexpr int N = V::size();
+    const V v([](int i) { return T(i + 1); });
+    std::vector<T> mem(N + 1);
+
+    // all patterns for small sizes, a selection of patterns otherwise
+    for (unsigned long long pattern :
+	 {0ull, ~0ull, 0x5555555555555555ull, 0xaaaaaaaaaaaaaaaaull, 0x0123456789abcdefull,
+	  0xfedcba9876543210ull, 1ull, 1ull << (N - 1), 0x8000000000000001ull})
+      for (int rot = 0; rot < (N <= 8 ? (1 << N) : 4); ++rot)
+	{
+	  const unsigned long long bits = N <= 8 ? rot : std::rotl(pattern, rot);
+	  const M k = (V([&](int i) { return T((bits >> i) & 1); }) == T(1));
+
+	  std::fill(mem.begin(), mem.end(), T(0));
+	  const int n = vir::compress_store(where(k, v), mem.data());
+	  COMPARE(n, int(popcount(k))) << k;
+	  for (int i = 0, j = 0; i < N; ++i)
+	    if (k[i])
+	      {
+		COMPARE(mem[j], v[i]) << "i = " << i << ", k = " << k;
+		++j;
+	      }
+	  for (int i = n; i <= N; ++i)
+	    COMPARE(mem[i], T(0)) << "i = " << i << ", k = " << k;
+
+	  for (int i = 0; i <= N; ++i)
+	    mem[i] = T(i % 61 + 1);
+	  std::vector<T> ref(N);
+	  for (int i = 0, j = 0; i < N; ++i)
+	    ref[i] = k[i] ? mem[j++] : T(0);
+	  V x = vir::expand_load<V>(k, mem.data());
+	  COMPARE(x, V([&](int i) { return ref[i]; })) << k;
+	  const auto x2 = vir::expand_load(k, mem.data());
+	  static_assert(std::is_same_v<std::remove_const_t<decltype(x2)>, V>);
+	  COMPARE(x2, x);
+
+	  // only popcount(k) values are read; the rest may be beyond the end of an allocation
+	  std::vector<T> exact(n);
+	  std::copy_n(mem.begin(), n, exact.begin());
+	  COMPARE(vir::expand_load<V>(k, exact.data()), x) << k;
+	}
+#endif
+  }
@@ -0,0 +1,109 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* Copyright © 2024      GSI Helmholtzzentrum fuer Schwerionenforschung GmbH
+ *                       Matthias Kretz <m.kretz@gsi.de>
+ */
+// expensive: * [1-9] * *
+#include "bits/main.h"
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+#include <vir/simd_execution.h>
+
+template <typename T>
+  constexpr bool
+  is_odd(T x)
+  {
+    if constexpr (std::is_floating_point_v<T>)
+      return std::fmod(x, T(2)) == T(1);
+    else
+      return (x & T(1)) == T(1);
+  }
+
+template <typename T>
+  void
+  test_policy(auto exec_simd, std::size_t size, std::size_t offset)
+  {
+    const auto pred = [](auto v) {
+      if constexpr (std::is_floating_point_v<T>)
+	return fmod(v, T(2)) == T(1);
+      else
+	return (v & T(1)) == T(1);
+    };
+
+    std::vector<T> data(size + offset);
+    std::iota(data.begin(), data.end(), T());
+    // make the predicate irregular
+    for (std::size_t i = 0; i < data.size(); i += 3)
+      data[i] = T(i / 3 * 2);
+    const auto first = data.begin() + offset;
+
+    std::vector<T> ref_true, ref_false;
+    std::copy_if(first, data.end(), std::back_inserter(ref_true), is_odd<T>);
+    std::remove_copy_if(first, data.end(), std::back_inserter(ref_false), is_odd<T>);
+
+    std::vector<T> out(size + 1, T(1));
+    auto it = vir::copy_if(exec_simd, first, data.end(), out.begin(), pred);
+    COMPARE(it - out.begin(), std::ptrdiff_t(ref_true.size())) << "size = " << size;
+    VERIFY(std::equal(ref_true.begin(), ref_true.end(), out.begin())) << "size = " << size;
+    COMPARE(*it, T(1));
+
+    std::fill(out.begin(), out.end(), T(1));
+    it = std::copy_if(exec_simd, first, data.end(), out.begin(), pred);
+    COMPARE(it - out.begin(), std::ptrdiff_t(ref_true.size())) << "size = " << size;
+    VERIFY(std::equal(ref_true.begin(), ref_true.end(), out.begin())) << "size = " << size;
+
+    std::vector<T> out2(size + 1, T(1));
+    std::fill(out.begin(), out.end(), T(1));
+    const auto [it1, it2]
+      = vir::partition_copy(exec_simd, first, data.end(), out.begin(), out2.begin(), pred);
+    COMPARE(it1 - out.begin(), std::ptrdiff_t(ref_true.size())) << "size = " << size;
+    COMPARE(it2 - out2.begin(), std::ptrdiff_t(ref_false.size())) << "size = " << size;
+    VERIFY(std::equal(ref_true.begin(), ref_true.end(), out.begin())) << "size = " << size;
+    VERIFY(std::equal(ref_false.begin(), ref_false.end(), out2.begin())) << "size = " << size;
+
+    auto data2 = data;
+    auto last = vir::remove_if(exec_simd, data2.begin() + offset, data2.end(), pred);
+    COMPARE(last - (data2.begin() + offset), std::ptrdiff_t(ref_false.size()))
+      << "size = " << size;
+    VERIFY(std::equal(ref_false.begin(), ref_false.end(), data2.begin() + offset))
+      << "size = " << size;
+
+    data2 = data;
+    last = std::remove_if(exec_simd, data2.begin() + offset, data2.end(), pred);
+    COMPARE(last - (data2.begin() + offset), std::ptrdiff_t(ref_false.size()))
+      << "size = " << size;
+    VERIFY(std::equal(ref_false.begin(), ref_false.end(), data2.begin() + offset))
+      << "size = " << size;
+  }
+
+template <typename V>
+  void
+  test()
+  {
+#if VIR_HAVE_SIMD_EXECUTION
+    using T = typename V::value_type;
+
+    constexpr auto exec_simd = vir::execution::simd.prefer_size<V::size()>();
+
+    for (std::size_t size : {0, 1, 2, 3, 5, 8, 17, 33, 64, 100})
+      {
+	test_policy<T>(exec_simd, size, 0);
+	test_policy<T>(exec_simd.prefer_aligned(), size, 1);
+	test_policy<T>(exec_simd.template unroll_by<3>(), size, 2);
+      }
+
+    {
+      std::vector<T> data(V::size() * 5 - 1);
+      for (std::size_t i = 0; i < data.size(); ++i)
+	data[i] = T(i % 7);
+      std::vector<T> out(data.size());
+      const auto it = vir::copy_if(exec_simd, data, out, [](auto v) { return v >= T(2); });
+      COMPARE(it - out.begin(), std::count_if(data.begin(), data.end(),
+					      [](T x) { return x >= T(2); }));
+      COMPARE(out[0], T(2));
+      COMPARE(out[1], T(3));
+    }
+#endif // VIR_HAVE_SIMD_EXECUTION
+  }
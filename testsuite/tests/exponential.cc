@@ -0,0 +1,58 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* Copyright © 2020–2024 GSI Helmholtzzentrum fuer Schwerionenforschung GmbH
+ *                       Matthias Kretz <m.kretz@gsi.de>
+ */
+
+// only: float|double|ldouble * * *
+// expensive: * [1-9] * *
+#include "bits/main.h"
+
+template <typename V>
+  void
+  test()
+  {
+    vir::test::setFuzzyness<float>(1);
+    vir::test::setFuzzyness<double>(1);
+
+    using T = typename V::value_type;
+    [[maybe_unused]] constexpr T nan = vir::quiet_NaN_v<T>;
+    constexpr T inf = vir::infinity_v<T>;
+    [[maybe_unused]] constexpr T denorm_min = vir::denorm_min_v<T>;
+    constexpr T norm_min = vir::norm_min_v<T>;
+    [[maybe_unused]] constexpr T min = vir::finite_min_v<T>;
+    constexpr T max = vir::finite_max_v<T>;
+    const T log_max = std::log(max);
+    test_values<V>({0.5,
+		    1,
+		    2,
+		    10,
+		    -0.5,
+		    -1,
+		    -2,
+		    -10,
+		    log_max,
+		    -log_max,
+		    std::log(norm_min),
+		    std::nextafter(log_max, T()),
+		    std::nextafter(log_max, inf),
+		    T(0x1p-20),
+		    T(-0x1p-20),
+#ifdef __STDC_IEC_559__
+		    nan,
+		    inf,
+		    -inf,
+		    denorm_min,
+		    -denorm_min,
+		    norm_min / 3,
+		    -norm_min / 3,
+		    -T(),
+		    -norm_min,
+		    min,
+		    T(),
+#endif
+		    norm_min,
+		    max},
+		   {10000, -log_max * T(1.1), log_max * T(1.1)},
+		   MAKE_TESTER(exp), MAKE_TESTER(exp2), MAKE_TESTER(expm1));
+    test_values<V>({}, {10000, -1, 1}, MAKE_TESTER(exp), MAKE_TESTER(exp2), MAKE_TESTER(expm1));
+  }
@@ -0,0 +1,95 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* Copyright © 2024      GSI Helmholtzzentrum fuer Schwerionenforschung GmbH
+ *                       Matthias Kretz <m.kretz@gsi.de>
+ */
+// expensive: * [1-9] * *
+#include "bits/main.h"
+
+#include <algorithm>
+#include <vector>
+
+#include <vir/simd_execution.h>
+
+template <typename T>
+  void
+  test_policy(auto exec_simd, std::size_t size, std::size_t offset)
+  {
+    std::vector<T> data(size + offset, T(1));
+    std::vector<T> data2(size + 1, T(1));
+    const auto first = data.begin() + offset;
+    const auto last = data.end();
+
+    const auto is_two = [](auto v) { return v == T(2); };
+    const auto is_one = [](auto v) { return v == T(1); };
+
+    COMPARE(vir::find_if(exec_simd, first, last, is_two), last) << "size = " << size;
+    COMPARE(vir::find_if_not(exec_simd, first, last, is_one), last) << "size = " << size;
+    VERIFY(not vir::any_of(exec_simd, first, last, is_two)) << "size = " << size;
+    VERIFY(vir::all_of(exec_simd, first, last, is_one)) << "size = " << size;
+    VERIFY(vir::none_of(exec_simd, first, last, is_two)) << "size = " << size;
+    COMPARE(vir::mismatch(exec_simd, first, last, data2.begin()).first, last)
+      << "size = " << size;
+    VERIFY(vir::equal(exec_simd, first, last, data2.begin())) << "size = " << size;
+    VERIFY(not vir::equal(exec_simd, first, last, data2.begin(), data2.end()))
+      << "size = " << size;
+
+    // every position of the first match (plus a second match later on)
+    for (std::size_t pos = 0; pos < size; ++pos)
+      {
+	first[pos] = T(2);
+	if (pos + 3 < size)
+	  first[pos + 3] = T(2);
+	const auto it = first + pos;
+	COMPARE(vir::find_if(exec_simd, first, last, is_two), it) << "pos = " << pos;
+	COMPARE(std::find_if(exec_simd, first, last, is_two), it) << "pos = " << pos;
+	COMPARE(vir::find_if_not(exec_simd, first, last, is_one), it) << "pos = " << pos;
+	COMPARE(std::find_if_not(exec_simd, first, last, is_one), it) << "pos = " << pos;
+	VERIFY(vir::any_of(exec_simd, first, last, is_two)) << "pos = " << pos;
+	VERIFY(not std::all_of(exec_simd, first, last, is_one)) << "pos = " << pos;
+	VERIFY(not vir::none_of(exec_simd, first, last, is_two)) << "pos = " << pos;
+
+	const auto [it1, it2] = vir::mismatch(exec_simd, first, last, data2.begin());
+	COMPARE(it1, it) << "pos = " << pos;
+	COMPARE(it2, data2.begin() + pos) << "pos = " << pos;
+	COMPARE(std::mismatch(exec_simd, first, last, data2.begin(), data2.end()).first, it)
+	  << "pos = " << pos;
+	VERIFY(not vir::equal(exec_simd, first, last, data2.begin())) << "pos = " << pos;
+	VERIFY(std::equal(exec_simd, first, last, data2.begin(),
+			  [](auto a, auto b) { return a >= b; })) << "pos = " << pos;
+
+	first[pos] = T(1);
+	if (pos + 3 < size)
+	  first[pos + 3] = T(1);
+      }
+  }
+
+template <typename V>
+  void
+  test()
+  {
+#if VIR_HAVE_SIMD_EXECUTION
+    using T = typename V::value_type;
+
+    constexpr auto exec_simd = vir::execution::simd.prefer_size<V::size()>();
+
+    for (std::size_t size : {0, 1, 2, 3, 5, 8, 17, 33, 64, 100})
+      {
+	test_policy<T>(exec_simd, size, 0);
+	test_policy<T>(exec_simd.prefer_aligned(), size, 1);
+	test_policy<T>(exec_simd.template unroll_by<3>(), size, 2);
+      }
+
+    {
+      std::vector<T> data(V::size() * 5 + 7);
+      for (std::size_t i = 0; i < data.size(); ++i)
+	data[i] = T(i % 7);
+      const auto it = vir::find_if(exec_simd, data, [](auto v) { return v == T(6); });
+      COMPARE(it - data.begin(), 6);
+      VERIFY(vir::all_of(exec_simd, data, [](auto v) { return v < T(7); }));
+      VERIFY(vir::equal(exec_simd, data, data));
+      auto data2 = data;
+      data2.back() = T(7);
+      COMPARE(vir::mismatch(exec_simd, data, data2).second, data2.end() - 1);
+    }
+#endif // VIR_HAVE_SIMD_EXECUTION
+  }
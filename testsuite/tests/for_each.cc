@@ -47,6 +47,23 @@ template <typename T, int N>
     }
   };
 
+template <typename T, typename U = double>
+  struct C
+  {
+    T a, b, c, d;
+    U e;
+
+    constexpr void
+    operator++()
+    { ++a, ++b, ++c, ++d, ++e; }
+
+    friend constexpr auto
+    operator==(C const& l, C const& r)
+    {
+      return l.a == r.a and l.b == r.b and l.c == r.c and l.d == r.d and l.e == r.e;
+    }
+  };
+
 template <typename V>
   void
   test()
@@ -84,6 +101,14 @@ template <typename V>
                       i += v.size();
                     });
 
+      i = 0;
+      std::for_each(exec_simd.template prefetch<256>(), data.begin(), data.end(),
+                    [&i](auto v) {
+                      COMPARE(v, vir::iota_v<decltype(v)> + i);
+                      i += v.size();
+                    });
+      COMPARE(i, T(data.size()));
+
       int count = vir::count_if(exec_simd, data, [](auto v) {
                     if constexpr (std::is_floating_point_v<T>)
                       return fmod(v, T(2)) == T(1);
@@ -99,6 +124,43 @@ template <typename V>
                   return (v & T(1)) == T(1);
               });
       COMPARE(count, int(data.size()) / 2);
+
+      vir::for_each(exec_simd.stream_stores().template unroll_by<2>(), data.begin() + 1, data.end(),
+                    [](auto&... v) { ((v += T(1)), ...); });
+      COMPARE(data[0], T(0));
+      for (std::size_t j = 1; j < data.size(); ++j)
+        COMPARE(data[j], T(j + 1));
+
+      // one call per chunk, the last chunk is padded
+      int calls = 0;
+      vir::for_each(exec_simd.masked_epilogue(), data.begin() + 1, data.end(), [&calls](auto& v) {
+        COMPARE(v.size(), V::size());
+        ++calls;
+        v -= T(1);
+      });
+      COMPARE(calls, int(data.size() - 1 + V::size() - 1) / int(V::size()));
+      for (std::size_t j = 0; j < data.size(); ++j)
+        COMPARE(data[j], T(j));
+
+      // the index is the position of the element in the range
+      if constexpr (V::size() <= vir::stdx::simd_abi::max_fixed_size<int>)
+        {
+          vir::for_each_indexed(exec_simd.prefer_aligned().template unroll_by<2>(),
+                                data.begin() + 1, data.end(), []<typename W>(const W& v, auto i) {
+                                  COMPARE(v, W([&](int k) { return T(i[k] + 1); }));
+                                });
+          vir::for_each_indexed<std::size_t>(exec_simd.masked_epilogue(), data,
+                                             [](auto& v, auto i) {
+            v += std::remove_cvref_t<decltype(v)>([&](int k) { return T(i[k]); });
+          });
+          for (std::size_t j = 0; j < data.size(); ++j)
+            COMPARE(data[j], T(2 * j));
+          vir::for_each_indexed(exec_simd.template parallel<2>(), data, [](auto& v, auto i) {
+            v -= std::remove_cvref_t<decltype(v)>([&](int k) { return T(i[k]); });
+          });
+          for (std::size_t j = 0; j < data.size(); ++j)
+            COMPARE(data[j], T(j));
+        }
     }
     {
       using U = vir::meta::as_unsigned_t<T>;
@@ -140,6 +202,34 @@ template <typename V>
       std::for_each(ref.begin(), ref.end(), op);
       COMPARE(data, ref);
     }
+    {
+      std::array<B<T, 7>, V::size() * 4 - 1> data;
+      std::iota(data.begin(), data.end(),
+                B<T, 7>{T(0), T(1), T(2), T(3), T(4), T(5), T(6)});
+      auto ref = data;
+      auto op = [](auto& v) {
+        for (int k = 0; k < 7; ++k)
+          v.x[k] += T(k + 1);
+      };
+      std::for_each(exec_simd, data.begin(), data.end(), op);
+      std::for_each(ref.begin(), ref.end(), op);
+      COMPARE(data, ref);
+    }
+    if constexpr (V::size() <= vir::stdx::simd_abi::max_fixed_size<double>)
+    {
+      std::array<C<T>, V::size() * 4 - 1> data;
+      std::iota(data.begin(), data.end(), C<T>{T(0), T(1), T(2), T(3), 4.});
+      auto ref = data;
+      auto op = [](auto& v) {
+        auto& [a, b, c, d, e] = v;
+        a += T(1);
+        d += T(4);
+        e += 5.;
+      };
+      std::for_each(exec_simd, data.begin(), data.end(), op);
+      std::for_each(ref.begin(), ref.end(), op);
+      COMPARE(data, ref);
+    }
 
 #endif // VIR_HAVE_SIMD_EXECUTION
   }
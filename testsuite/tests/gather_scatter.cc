@@ -0,0 +1,73 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* Copyright © 2024      GSI Helmholtzzentrum fuer Schwerionenforschung GmbH
+ *                       Matthias Kretz <m.kretz@gsi.de>
+ */
+// expensive: * [1-9] * *
+#include "bits/main.h"
+
+#include <vector>
+
+#include <vir/simd_permute.h>
+
+template <typename V, typename IT>
+  void
+  test_index_type()
+  {
+#if VIR_HAVE_SIMD_PERMUTE
+    using T = typename V::value_type;
+    using I = vir::stdx::fixed_size_simd<IT, V::size()>;
+    constexpr int size = 97;
+    std::vector<T> table(size);
+    for (int i = 0; i < size; ++i)
+      table[i] = T(i % 61 + 1);
+
+    const I idx([](int i) { return IT((i * 37 + 5) % size); });
+    const V ref([&](int i) { return table[idx[i]]; });
+
+    V x = vir::simd_gather<V>(table.data(), idx);
+    COMPARE(x, ref);
+
+    const auto x2 = vir::simd_gather(table.data(), idx);
+    static_assert(std::is_same_v<std::remove_const_t<decltype(x2)>,
+				 vir::stdx::rebind_simd_t<T, I>>);
+    COMPARE(vir::stdx::static_simd_cast<V>(x2), ref);
+
+    const typename V::mask_type k = V([](int i) { return T(i % 3); }) != T(1);
+    x = T(0);
+    vir::simd_gather(where(k, x), table.data(), idx);
+    COMPARE(x, V([&](int i) { return k[i] ? ref[i] : T(0); }));
+
+    // masked-off indexes must not be dereferenced
+    const I bad_idx([&](int i) { return k[i] ? idx[i] : IT(std::numeric_limits<int>::max()); });
+    x = T(0);
+    vir::simd_gather(where(k, x), table.data(), bad_idx);
+    COMPARE(x, V([&](int i) { return k[i] ? ref[i] : T(0); }));
+
+    std::vector<T> out(size);
+    vir::simd_scatter(ref, out.data(), idx);
+    for (std::size_t i = 0; i < V::size(); ++i)
+      COMPARE(out[idx[i]], ref[i]) << "i = " << i;
+
+    std::fill(out.begin(), out.end(), T(0));
+    vir::simd_scatter(where(k, ref), out.data(), bad_idx);
+    for (std::size_t i = 0; i < V::size(); ++i)
+      COMPARE(out[idx[i]], k[i] ? ref[i] : T(0)) << "i = " << i;
+
+    // the highest element wins if indexes collide
+    std::fill(out.begin(), out.end(), T(0));
+    vir::simd_scatter(V([](int i) { return T(i + 1); }), out.data(), I(IT(3)));
+    COMPARE(out[3], T(V::size()));
+#endif
+  }
+
+template <typename V>
+  void
+  test()
+  {
+    if constexpr (V::size() <= vir::stdx::simd_abi::max_fixed_size<int>)
+      {
+	test_index_type<V, int>();
+	test_index_type<V, unsigned short>();
+	test_index_type<V, long>();
+      }
+  }
@@ -15,11 +15,11 @@ template <typename V>
     vir::test::setFuzzyness<double>(1);
 
     using T = typename V::value_type;
-    constexpr T nan = vir::quiet_NaN_v<T>;
-    constexpr T inf = vir::infinity_v<T>;
-    constexpr T denorm_min = vir::denorm_min_v<T>;
+    [[maybe_unused]] constexpr T nan = vir::quiet_NaN_v<T>;
+    [[maybe_unused]] constexpr T inf = vir::infinity_v<T>;
+    [[maybe_unused]] constexpr T denorm_min = vir::denorm_min_v<T>;
     constexpr T norm_min = vir::norm_min_v<T>;
-    constexpr T min = vir::finite_min_v<T>;
+    [[maybe_unused]] constexpr T min = vir::finite_min_v<T>;
     constexpr T max = vir::finite_max_v<T>;
     test_values<V>({1,
 		    2,
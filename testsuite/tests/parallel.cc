@@ -0,0 +1,83 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* Copyright © 2024      GSI Helmholtzzentrum fuer Schwerionenforschung GmbH
+ *                       Matthias Kretz <m.kretz@gsi.de>
+ */
+// expensive: * [1-9] * *
+#include "bits/main.h"
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+#include <vir/simd_execution.h>
+
+template <typename T>
+  void
+  test_policy(auto exec_simd, std::size_t size)
+  {
+    std::vector<T> data(size);
+    for (std::size_t i = 0; i < size; ++i)
+      data[i] = T(i % 5);
+    const T max_value = T(std::min<std::size_t>(size - 1, 4));
+
+    std::vector<T> out(size);
+    vir::transform(exec_simd, data, out, [](auto v) { return v + T(1); });
+    for (std::size_t i = 0; i < size; ++i)
+      COMPARE(out[i], T(i % 5 + 1)) << "i = " << i;
+
+    std::transform(exec_simd, data.begin(), data.end(), out.begin(), out.begin(),
+		   [](auto a, auto b) { return a + b; });
+    for (std::size_t i = 0; i < size; ++i)
+      COMPARE(out[i], T(i % 5 * 2 + 1)) << "i = " << i;
+
+    vir::for_each(exec_simd, out, [](auto&... v) { ((v -= T(1)), ...); });
+    for (std::size_t i = 0; i < size; ++i)
+      COMPARE(out[i], T(i % 5 * 2)) << "i = " << i;
+
+    if constexpr (exec_simd._size <= vir::stdx::simd_abi::max_fixed_size<int>)
+      {
+	const int count = vir::count_if(exec_simd, data, [](auto v) { return v > T(2); });
+	COMPARE(count, int(std::count_if(data.begin(), data.end(), [](T x) { return x > T(2); })));
+      }
+
+    const auto max_op = [](auto a, auto b) {
+      using std::max;
+      using vir::stdx::max;
+      return max(a, b);
+    };
+    COMPARE(vir::reduce(exec_simd, data, T(0), max_op), max_value);
+    COMPARE(std::reduce(exec_simd, data.begin(), data.end(), T(7), max_op), T(7));
+    COMPARE(vir::transform_reduce(exec_simd, data, T(0), max_op, [](auto v) { return v * T(2); }),
+	    T(max_value * 2));
+
+    // sums of small integers are exact in double
+    if constexpr (exec_simd._size <= vir::stdx::simd_abi::max_fixed_size<double>)
+      {
+	const double sum = std::accumulate(data.begin(), data.end(), 0.);
+	COMPARE(vir::transform_reduce(exec_simd, data, 1., std::plus<>(),
+				      [](auto v) {
+					using VD = vir::stdx::rebind_simd_t<double, decltype(v)>;
+					return vir::stdx::static_simd_cast<VD>(v);
+				      }),
+		sum + 1);
+      }
+  }
+
+template <typename V>
+  void
+  test()
+  {
+#if VIR_HAVE_SIMD_EXECUTION
+    using T = typename V::value_type;
+
+    constexpr auto exec_simd = vir::execution::simd.prefer_size<V::size()>();
+    constexpr std::size_t block = 256 * 1024 / sizeof(T);
+
+    for (std::size_t size : {std::size_t(1), std::size_t(100), 2 * block + 1, 3 * block - 7})
+      {
+	test_policy<T>(exec_simd.template parallel<3>(), size);
+	test_policy<T>(exec_simd.parallel().prefer_aligned(), size);
+	test_policy<T>(exec_simd.template unroll_by<2>().template parallel<2>(), size);
+      }
+#endif // VIR_HAVE_SIMD_EXECUTION
+  }
@@ -0,0 +1,100 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* Copyright © 2024      GSI Helmholtzzentrum fuer Schwerionenforschung GmbH
+ *                       Matthias Kretz <m.kretz@gsi.de>
+ */
+// expensive: * [1-9] * *
+#include "bits/main.h"
+
+#include <numeric>
+#include <vector>
+
+#include <vir/simd_execution.h>
+
+template <typename T>
+  void
+  test_policy(auto exec_simd, std::size_t size, std::size_t offset)
+  {
+    // small values, such that sums are exact and don't overflow for char
+    std::vector<T> data(size + offset);
+    for (std::size_t i = 0; i < data.size(); ++i)
+      data[i] = T(i % 3);
+    const auto first = data.begin() + offset;
+    const auto last = data.end();
+
+    std::vector<T> ref(size);
+    std::vector<T> out(size + 1, T(9));
+
+    std::inclusive_scan(first, last, ref.begin());
+    auto it = vir::inclusive_scan(exec_simd, first, last, out.begin());
+    COMPARE(it - out.begin(), std::ptrdiff_t(size)) << "size = " << size;
+    VERIFY(std::equal(ref.begin(), ref.end(), out.begin())) << "size = " << size;
+    COMPARE(out[size], T(9));
+
+    std::inclusive_scan(first, last, ref.begin(), std::plus<>(), T(1));
+    it = std::inclusive_scan(exec_simd, first, last, out.begin(), std::plus<>(), T(1));
+    COMPARE(it - out.begin(), std::ptrdiff_t(size)) << "size = " << size;
+    VERIFY(std::equal(ref.begin(), ref.end(), out.begin())) << "size = " << size;
+
+    // an operation without identity element for the shifted-in zeros
+    const auto max_op = [](auto a, auto b) { return max(a, b); };
+    std::inclusive_scan(first, last, ref.begin(), [](T a, T b) { return std::max(a, b); });
+    it = vir::inclusive_scan(exec_simd, first, last, out.begin(), max_op);
+    COMPARE(it - out.begin(), std::ptrdiff_t(size)) << "size = " << size;
+    VERIFY(std::equal(ref.begin(), ref.end(), out.begin())) << "size = " << size;
+
+    std::exclusive_scan(first, last, ref.begin(), T(2));
+    it = vir::exclusive_scan(exec_simd, first, last, out.begin(), T(2));
+    COMPARE(it - out.begin(), std::ptrdiff_t(size)) << "size = " << size;
+    VERIFY(std::equal(ref.begin(), ref.end(), out.begin())) << "size = " << size;
+
+    std::exclusive_scan(first, last, ref.begin(), T(1), [](T a, T b) { return std::max(a, b); });
+    it = std::exclusive_scan(exec_simd, first, last, out.begin(), T(1), max_op);
+    COMPARE(it - out.begin(), std::ptrdiff_t(size)) << "size = " << size;
+    VERIFY(std::equal(ref.begin(), ref.end(), out.begin())) << "size = " << size;
+
+    std::transform_inclusive_scan(first, last, ref.begin(), std::plus<>(),
+				  [](T x) { return T(x * 2); });
+    it = vir::transform_inclusive_scan(exec_simd, first, last, out.begin(), std::plus<>(),
+				       [](auto x) { return x * 2; });
+    COMPARE(it - out.begin(), std::ptrdiff_t(size)) << "size = " << size;
+    VERIFY(std::equal(ref.begin(), ref.end(), out.begin())) << "size = " << size;
+
+    std::transform_inclusive_scan(first, last, ref.begin(), std::plus<>(),
+				  [](T x) { return T(x * 2); }, T(3));
+    it = std::transform_inclusive_scan(exec_simd, first, last, out.begin(), std::plus<>(),
+				       [](auto x) { return x * 2; }, T(3));
+    COMPARE(it - out.begin(), std::ptrdiff_t(size)) << "size = " << size;
+    VERIFY(std::equal(ref.begin(), ref.end(), out.begin())) << "size = " << size;
+
+    // in-place
+    std::inclusive_scan(first, last, ref.begin());
+    vir::inclusive_scan(exec_simd, first, last, first);
+    VERIFY(std::equal(ref.begin(), ref.end(), first)) << "size = " << size;
+  }
+
+template <typename V>
+  void
+  test()
+  {
+#if VIR_HAVE_SIMD_EXECUTION
+    using T = typename V::value_type;
+
+    constexpr auto exec_simd = vir::execution::simd.prefer_size<V::size()>();
+
+    for (std::size_t size : {0, 1, 2, 3, 5, 8, 17, 33, 50})
+      {
+	test_policy<T>(exec_simd, size, 0);
+	test_policy<T>(exec_simd.prefer_aligned(), size, 1);
+	test_policy<T>(exec_simd.template unroll_by<3>(), size, 2);
+      }
+
+    {
+      std::vector<T> data(V::size() * 2 + 3, T(1));
+      std::vector<T> out(data.size());
+      const auto it = vir::exclusive_scan(exec_simd, data, out, T());
+      COMPARE(it, out.end());
+      for (std::size_t i = 0; i < out.size(); ++i)
+	COMPARE(out[i], T(i)) << "i = " << i;
+    }
+#endif // VIR_HAVE_SIMD_EXECUTION
+  }
@@ -0,0 +1,151 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* Copyright © 2024      GSI Helmholtzzentrum fuer Schwerionenforschung GmbH
+ *                       Matthias Kretz <m.kretz@gsi.de>
+ */
+// expensive: * [1-9] * *
+#include "bits/main.h"
+
+#include <array>
+#include <deque>
+#include <numeric>
+#include <span>
+#include <vector>
+
+#include <vir/simd_execution.h>
+
+// Fixed-capacity ring buffer: the elements start at `head` and wrap around at the end of `data`.
+// vir::segments finds its two contiguous segments via the segments() member.
+template <typename T>
+  struct ring_buffer
+  {
+    std::vector<T> data;
+    std::size_t head = 0;
+
+    struct iterator
+    {
+      using value_type = T;
+      using difference_type = std::ptrdiff_t;
+
+      ring_buffer* ring = nullptr;
+      std::size_t i = 0;
+
+      T&
+      operator*() const
+      { return ring->data[(ring->head + i) % ring->data.size()]; }
+
+      iterator&
+      operator++()
+      {
+	++i;
+	return *this;
+      }
+
+      iterator
+      operator++(int)
+      { return {ring, i++}; }
+
+      bool
+      operator==(const iterator&) const = default;
+    };
+
+    iterator
+    begin()
+    { return {this, 0}; }
+
+    iterator
+    end()
+    { return {this, data.size()}; }
+
+    std::array<std::span<T>, 2>
+    segments()
+    { return {std::span<T>(data).subspan(head), std::span<T>(data).first(head)}; }
+  };
+
+namespace adl
+{
+  struct chunks
+  {
+    std::vector<float> a, b;
+
+    friend std::array<std::span<const float>, 2>
+    segments(const chunks& c)
+    { return {c.a, c.b}; }
+  };
+}
+
+#if VIR_HAVE_SIMD_EXECUTION
+static_assert(std::forward_iterator<ring_buffer<float>::iterator>);
+static_assert(vir::detail::simd_execution_segmented_range<ring_buffer<float>&>);
+static_assert(not vir::detail::simd_execution_gatherable_range<ring_buffer<float>&>);
+static_assert(not vir::detail::simd_execution_segmented_range<std::vector<float>&>);
+static_assert(requires(const adl::chunks& c) { vir::segments(c); });
+#ifdef __GLIBCXX__
+static_assert(vir::detail::simd_execution_segmented_range<std::deque<float>&>);
+static_assert(vir::detail::simd_execution_segmented_iterator<std::deque<int>::const_iterator>);
+#endif
+#endif
+
+template <typename V>
+  void
+  test()
+  {
+#if VIR_HAVE_SIMD_EXECUTION
+    using T = typename V::value_type;
+    constexpr int N = V::size();
+    constexpr auto exec_simd = vir::execution::simd.prefer_size<N>();
+
+    // std::deque: many segments, the first and last segments are partial
+    for (std::size_t size : {std::size_t(N * 3 + 1),
+			     vir::detail::parallel_block_size<T, 1> * 2 + 5})
+      {
+	std::deque<T> dq;
+	for (std::size_t i = 0; i < size; ++i)
+	  dq.push_back(T(i % 3));
+	dq.pop_front();
+	dq.push_front(T(1));
+	T ref = 0;
+	for (T x : dq)
+	  ref = T(ref + x);
+
+	COMPARE(vir::reduce(exec_simd, dq), ref) << "size = " << size;
+	COMPARE(std::reduce(exec_simd, dq.begin() + 1, dq.end(), T(1)), ref) << "size = " << size;
+	COMPARE(vir::reduce(exec_simd.template unroll_by<2>().template parallel<3>(), dq), ref)
+	  << "size = " << size;
+	COMPARE(vir::transform_reduce(exec_simd.parallel(), dq, T(1), std::plus<>(),
+				      [](auto v) { return v; }), T(ref + 1)) << "size = " << size;
+
+	vir::for_each(exec_simd.parallel(), dq, [](auto& v) { v += T(1); });
+	std::vector<T> out(size);
+	vir::transform(exec_simd, dq, out, [](auto v) { return v - T(1); });
+	COMPARE(out[0], T(1));
+	for (std::size_t i = 1; i < size; ++i)
+	  COMPARE(out[i], T(i % 3)) << "i = " << i << ", size = " << size;
+
+	std::transform(exec_simd.template parallel<2>(), dq.cbegin(), dq.cend(), out.begin(),
+		       out.begin(), [](auto a, auto b) { return a - b; });
+	for (std::size_t i = 0; i < size; ++i)
+	  COMPARE(out[i], T(1)) << "i = " << i << ", size = " << size;
+
+	COMPARE(vir::transform_reduce(exec_simd, dq, out, T()), T(ref + T(size)))
+	  << "size = " << size;
+      }
+
+    // user-defined segmented range
+    ring_buffer<T> ring {std::vector<T>(N * 2 + 3), N + 1};
+    for (std::size_t i = 0; i < ring.data.size(); ++i)
+      ring.data[(ring.head + i) % ring.data.size()] = T(i);
+    T ref = 0;
+    for (T x : ring)
+      ref = T(ref + x);
+    COMPARE(vir::reduce(exec_simd, ring), ref);
+    COMPARE(vir::reduce(exec_simd.parallel(), ring, T(1)), T(ref + 1));
+
+    vir::for_each(exec_simd, ring, [](auto& v) { v += T(1); });
+    std::vector<T> out(ring.data.size());
+    vir::transform(exec_simd, ring, out, [](auto v) { return v; });
+    for (std::size_t i = 0; i < out.size(); ++i)
+      COMPARE(out[i], T(i + 1)) << "i = " << i;
+    COMPARE(vir::transform_reduce(exec_simd, ring, out, T(), std::plus<>(),
+				  [](auto a, auto b) { return a - b; }), T());
+#endif // VIR_HAVE_SIMD_EXECUTION
+  }
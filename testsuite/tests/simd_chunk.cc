@@ -0,0 +1,106 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* Copyright © 2024      GSI Helmholtzzentrum fuer Schwerionenforschung GmbH
+ *                       Matthias Kretz <m.kretz@gsi.de>
+ */
+// expensive: * [1-9] * *
+#include "bits/main.h"
+
+#include <numeric>
+#include <ranges>
+#include <vector>
+
+#include <vir/simd_execution.h>
+
+template <typename T>
+  struct Point
+  {
+    T x, y;
+  };
+
+#if VIR_HAVE_SIMD_EXECUTION
+using float_chunks = vir::simd_chunk_view<std::ranges::ref_view<std::vector<float>>, 4,
+					  vir::simd_chunk_tail::pad>;
+static_assert(std::ranges::view<float_chunks>);
+static_assert(std::ranges::random_access_range<float_chunks>);
+static_assert(std::ranges::sized_range<float_chunks>);
+static_assert(std::same_as<std::ranges::range_value_t<float_chunks>, vir::simdize<float, 4>>);
+#endif
+
+template <typename V>
+  void
+  test()
+  {
+#if VIR_HAVE_SIMD_EXECUTION
+    using T = typename V::value_type;
+    constexpr int N = V::size();
+    using vir::simd_chunk_tail;
+
+    const std::vector<T> data = [] {
+      std::vector<T> r(N * 3 + 2);
+      for (std::size_t i = 0; i < r.size(); ++i)
+	r[i] = T(i % 7 + 1);
+      return r;
+    }();
+
+    // pad
+    auto chunks = vir::views::simd_chunk<N>(data);
+    COMPARE(chunks.size(), std::size_t(N == 1 ? 5 : 4));
+    std::size_t i = 0;
+    for (const V& x : chunks)
+      for (int k = 0; k < N; ++k, ++i)
+	COMPARE(x[k], i < data.size() ? data[i] : T()) << "i = " << i;
+    COMPARE(i, chunks.size() * N);
+
+    // pipe syntax and composition with std views
+    auto plus1 = data | vir::views::simd_chunk<N>
+		   | std::views::transform([](const V& x) { return x + T(1); })
+		   | std::views::take(2);
+    COMPARE(std::ranges::distance(plus1), 2);
+    i = 0;
+    for (const V& x : plus1)
+      for (int k = 0; k < N; ++k, ++i)
+	COMPARE(x[k], T(data[i] + T(1))) << "i = " << i;
+    COMPARE(chunks[1], V(data.data() + N, vir::stdx::element_aligned));
+    COMPARE(chunks.end() - chunks.begin(), std::ptrdiff_t(chunks.size()));
+
+    // masked
+    i = 0;
+    for (const auto& [x, k] : vir::views::simd_chunk<N, simd_chunk_tail::masked>(data))
+      {
+	const std::size_t valid = std::min(data.size() - i, std::size_t(N));
+	COMPARE(popcount(k), int(valid)) << "i = " << i;
+	COMPARE(x, V([&](std::size_t j) { return j < valid ? data[i + j] : T(); }));
+	i += N;
+      }
+
+    // scalar tail
+    const auto full = vir::views::simd_chunk<N, simd_chunk_tail::scalar>(data);
+    COMPARE(full.size(), data.size() / N);
+    COMPARE(full.tail().size(), data.size() % N);
+    V sum = 0;
+    for (const V& x : full)
+      sum += x;
+    T total = reduce(sum);
+    for (T x : full.tail())
+      total += x;
+    COMPARE(total, std::accumulate(data.begin(), data.end(), T()));
+
+#if __cpp_lib_ranges_zip >= 202110L
+    for (const auto& [a, b] : std::views::zip(chunks, vir::views::simd_chunk<N>(data)))
+      COMPARE(a, b);
+#endif
+
+    // structs
+    std::vector<Point<T>> points(N + 1);
+    for (std::size_t j = 0; j < points.size(); ++j)
+      points[j] = {T(j), T(j + 1)};
+    i = 0;
+    for (const auto& p : vir::views::simd_chunk<N>(points))
+      for (int k = 0; k < N; ++k, ++i)
+	{
+	  const Point<T> pk = p[k];
+	  COMPARE(pk.x, i < points.size() ? T(i) : T()) << "i = " << i;
+	  COMPARE(pk.y, i < points.size() ? T(i + 1) : T()) << "i = " << i;
+	}
+#endif // VIR_HAVE_SIMD_EXECUTION
+  }
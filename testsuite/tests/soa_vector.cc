@@ -0,0 +1,166 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* Copyright © 2024      GSI Helmholtzzentrum fuer Schwerionenforschung GmbH
+ *                       Matthias Kretz <m.kretz@gsi.de>
+ */
+// expensive: * [1-9] * *
+#include "bits/main.h"
+
+#include <cstdint>
+#include <utility>
+
+#include <vir/soa_vector.h>
+#include <vir/simd_execution.h>
+
+template <typename T>
+  struct Vec3
+  {
+    T x, y, z;
+  };
+
+template <typename T>
+  struct Particle
+  {
+    Vec3<T> pos;
+    Vec3<T> vel;
+    T m;
+  };
+
+#if VIR_HAVE_SOA_VECTOR
+using float_particles = vir::soa_vector<Particle<float>>;
+static_assert(std::random_access_iterator<float_particles::iterator>);
+static_assert(std::random_access_iterator<float_particles::const_iterator>);
+static_assert(std::indirectly_writable<float_particles::iterator, Particle<float>>);
+static_assert(not std::indirectly_writable<float_particles::const_iterator, Particle<float>>);
+static_assert(std::ranges::sized_range<float_particles>);
+static_assert(std::same_as<float_particles::simd_type, vir::simdize<Particle<float>>>);
+#endif
+
+template <typename T>
+  Particle<T>
+  make_particle(std::size_t i)
+  {
+    const T a = T(i % 7);
+    return {{a, T(1), T(2)}, {T(3), T(4), T(5)}, T(a + 1)};
+  }
+
+template <typename V>
+  void
+  test()
+  {
+#if VIR_HAVE_SOA_VECTOR
+    using T = typename V::value_type;
+    constexpr int N = V::size();
+    using P = Particle<T>;
+    using SoA = vir::soa_vector<P>;
+
+    SoA data;
+    VERIFY(data.empty());
+    const std::size_t n = N * 3 + 1;
+    for (std::size_t i = 0; i < n; ++i)
+      data.push_back(make_particle<T>(i));
+    COMPARE(data.size(), n);
+    VERIFY(data.capacity() >= n);
+    COMPARE(data.capacity() % SoA::simd_size, 0u);
+    for (std::size_t i = 0; i < n; ++i)
+      {
+	const P p = data[i];
+	COMPARE(p.pos.x, T(i % 7)) << "i = " << i;
+	COMPARE(p.vel.z, T(5)) << "i = " << i;
+	COMPARE(p.m, T(i % 7 + 1)) << "i = " << i;
+      }
+
+    // one array per flat data member
+    COMPARE(data.template member<0>().size(), n);
+    COMPARE(data.template member<5>()[n - 1], T(5));
+    COMPARE(reinterpret_cast<std::uintptr_t>(data.template member<3>().data()) % SoA::alignment,
+	    0u);
+
+    // proxy references
+    data[1].template member<1>() = T(2);
+    data[2] = data[1];
+    COMPARE(P(data[2]).pos.y, T(2));
+    COMPARE(P(data[2]).m, T(2));
+    data[1] = make_particle<T>(1);
+    data[2] = make_particle<T>(2);
+
+    // simd_at and simd_store
+    for (std::size_t i = 0; i + N <= data.capacity(); i += N)
+      {
+	const vir::simdize<P, N> p = data.template simd_at<N>(i);
+	for (int k = 0; k < N and i + k < n; ++k)
+	  {
+	    COMPARE(vir::get<0>(p).x[k], T((i + k) % 7)) << "i = " << i + k;
+	    COMPARE(vir::get<2>(p)[k], T((i + k) % 7 + 1)) << "i = " << i + k;
+	  }
+      }
+    {
+      vir::simdize<P, N> p = data.template simd_at<N>(N);
+      vir::get<1>(p).x += T(1);
+      data.simd_store(N, p);
+      for (std::size_t i = 0; i < n; ++i)
+	COMPARE(P(data[i]).vel.x, T(i >= N and i < 2 * N ? 4 : 3)) << "i = " << i;
+      vir::get<1>(p).x -= T(1);
+      data.simd_store(N, p);
+    }
+
+#if VIR_HAVE_SIMD_EXECUTION
+    constexpr auto exec_simd = vir::execution::simd.prefer_size<N>();
+
+    vir::for_each(exec_simd, data, [](auto& p) {
+      auto& [pos, vel, m] = p;
+      pos.x += vel.x;
+      m -= T(1);
+    });
+    for (std::size_t i = 0; i < n; ++i)
+      {
+	const P p = data[i];
+	COMPARE(p.pos.x, T(i % 7 + 3)) << "i = " << i;
+	COMPARE(p.m, T(i % 7)) << "i = " << i;
+      }
+
+    T sum = vir::transform_reduce(exec_simd, data, T(), std::plus<>(),
+				  [](const auto& p) { return vir::get<2>(p); });
+    T ref = 0;
+    for (std::size_t i = 0; i < n; ++i)
+      ref += T(i % 7);
+    COMPARE(sum, ref);
+
+    // chunks that do not start at a multiple of N
+    sum = vir::transform_reduce(exec_simd, data.begin() + 3, data.end(), T(), std::plus<>(),
+				[](const auto& p) { return vir::get<2>(p); });
+    COMPARE(sum, T(ref - 3));
+
+    vir::soa_vector<Vec3<T>> out(n);
+    vir::transform(exec_simd, data.begin(), data.end(), out.begin(),
+		   [](const auto& p) { return vir::get<1>(p); });
+    for (std::size_t i = 0; i < n; ++i)
+      {
+	const Vec3<T> v = out[i];
+	COMPARE(v.x, T(3)) << "i = " << i;
+	COMPARE(v.y, T(4)) << "i = " << i;
+	COMPARE(v.z, T(5)) << "i = " << i;
+      }
+#endif
+
+    // copy, move, resize
+    SoA copy = data;
+    COMPARE(copy.size(), n);
+    COMPARE(P(copy[n - 1]).pos.x, P(data[n - 1]).pos.x);
+    copy.resize(2 * n);
+    COMPARE(copy.size(), 2 * n);
+    COMPARE(P(copy[n]).m, T());
+    COMPARE(P(copy[n - 1]).vel.y, T(4));
+    SoA moved = std::move(copy);
+    COMPARE(moved.size(), 2 * n);
+    COMPARE(copy.size(), 0u);
+    moved.pop_back();
+    COMPARE(moved.size(), 2 * n - 1);
+    moved.resize(2 * n + 1, make_particle<T>(3));
+    COMPARE(P(moved[2 * n]).pos.x, T(3));
+    moved.clear();
+    VERIFY(moved.empty());
+    const SoA init = {make_particle<T>(4), make_particle<T>(5)};
+    COMPARE(init.size(), 2u);
+    COMPARE(init[1].m, T(6));
+#endif // VIR_HAVE_SOA_VECTOR
+  }
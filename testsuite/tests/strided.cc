@@ -0,0 +1,94 @@
+/* SPDX-License-Identifier: GPL-3.0-or-later */
+/* Copyright © 2024      GSI Helmholtzzentrum fuer Schwerionenforschung GmbH
+ *                       Matthias Kretz <m.kretz@gsi.de>
+ */
+// expensive: * [1-9] * *
+#include "bits/main.h"
+
+#include <deque>
+#include <numeric>
+#include <vector>
+
+#include <vir/simd_execution.h>
+
+#if VIR_HAVE_SIMD_EXECUTION
+static_assert(std::random_access_iterator<vir::strided_iterator<float>>);
+static_assert(std::ranges::view<vir::strided_view<const float>>);
+static_assert(vir::detail::simd_execution_gather_iterator<vir::strided_iterator<float>>);
+static_assert(vir::detail::simd_execution_gatherable_range<std::deque<int>>);
+static_assert(not vir::detail::simd_execution_gatherable_range<std::vector<bool>>);
+#endif
+
+template <typename V>
+  void
+  test()
+  {
+#if VIR_HAVE_SIMD_EXECUTION
+    using T = typename V::value_type;
+    constexpr int N = V::size();
+    constexpr auto exec_simd = vir::execution::simd.prefer_size<N>();
+
+    // row-major matrix; every column is a strided range
+    constexpr int rows = N * 3 + 1;
+    constexpr int cols = 5;
+    std::vector<T> matrix(rows * cols);
+    for (int r = 0; r < rows; ++r)
+      for (int c = 0; c < cols; ++c)
+	matrix[r * cols + c] = T((r + c) % 7);
+    auto at = [&](int r, int c) -> T& { return matrix[r * cols + c]; };
+
+    const vir::strided_view col1(matrix.data() + 1, rows, cols);
+    COMPARE(col1.size(), std::size_t(rows));
+    COMPARE(col1[2], at(2, 1));
+
+    T ref = 0;
+    for (int r = 0; r < rows; ++r)
+      ref += at(r, 1);
+    COMPARE(vir::reduce(exec_simd, col1), ref);
+    COMPARE(std::reduce(exec_simd.prefer_aligned(), col1.begin(), col1.end(), T(1)), T(ref + 1));
+    COMPARE(vir::reduce(exec_simd.template unroll_by<2>().template parallel<2>(), col1), ref);
+
+    vir::for_each(exec_simd, col1, [](auto& v) { v += T(1); });
+    for (int r = 0; r < rows; ++r)
+      {
+	COMPARE(at(r, 0), T(r % 7)) << "r = " << r;
+	COMPARE(at(r, 1), T((r + 1) % 7 + 1)) << "r = " << r;
+	COMPARE(at(r, 2), T((r + 2) % 7)) << "r = " << r;
+      }
+
+    // column -> contiguous -> column
+    std::vector<T> tmp(rows);
+    vir::transform(exec_simd, col1, tmp, [](auto v) { return v - T(1); });
+    for (int r = 0; r < rows; ++r)
+      COMPARE(tmp[r], T((r + 1) % 7)) << "r = " << r;
+    vir::strided_view col4(matrix.data() + 4, rows, cols);
+    std::transform(exec_simd.masked_epilogue(), tmp.begin(), tmp.end(), col1.begin(),
+		   col4.begin(), [](auto a, auto b) { return b - a; });
+    for (int r = 0; r < rows; ++r)
+      {
+	COMPARE(at(r, 3), T((r + 3) % 7)) << "r = " << r;
+	COMPARE(at(r, 4), T(1)) << "r = " << r;
+      }
+
+    const vir::strided_view col3(std::as_const(matrix).data() + 3, rows, cols);
+    T dot = 0;
+    for (int r = 0; r < rows; ++r)
+      dot += at(r, 3) * tmp[r];
+    COMPARE(vir::transform_reduce(exec_simd, col3, tmp, T()), dot);
+    COMPARE(std::transform_reduce(exec_simd, tmp.begin(), tmp.end(), col3.begin(), T()), dot);
+
+    // negative stride
+    const vir::strided_view reversed(tmp.data() + rows - 1, rows, -1);
+    std::vector<T> out(rows);
+    vir::transform(exec_simd, reversed, out, [](auto v) { return v; });
+    for (int r = 0; r < rows; ++r)
+      COMPARE(out[r], tmp[rows - 1 - r]) << "r = " << r;
+
+    // random-access iterators that are neither contiguous, nor strided, nor segmented
+    auto rev = std::views::reverse(out);
+    COMPARE(vir::reduce(exec_simd, rev), std::reduce(tmp.begin(), tmp.end()));
+    vir::for_each(exec_simd.template unroll_by<2>(), rev, [](auto&... v) { ((v *= T(2)), ...); });
+    for (int r = 0; r < rows; ++r)
+      COMPARE(out[r], T(tmp[rows - 1 - r] * 2)) << "r = " << r;
+#endif // VIR_HAVE_SIMD_EXECUTION
+  }
@@ -48,6 +48,46 @@ template <typename V>
     COMPARE(i, T(data0.size()));
     COMPARE(data0, data1);
 
+    vir::transform(exec_simd.stream_stores(), data0.begin() + 1, data0.end(), data1.begin() + 1,
+                   [](auto v) { return v + 2; });
+    for (std::size_t i = 1; i < data1.size(); ++i)
+      COMPARE(data1[i], T(i + 2));
+
+    vir::transform(exec_simd.masked_epilogue(), data0.begin() + 1, data0.end(), data1.begin() + 1,
+                   data1.begin() + 1, [](auto v, auto w) {
+                     COMPARE(v.size(), V::size());
+                     return w - v;
+                   });
+    COMPARE(data1[0], T(0));
+    for (std::size_t i = 1; i < data1.size(); ++i)
+      COMPARE(data1[i], T(2));
+
+    // the index is the position of the element in the input range
+    if constexpr (N <= vir::stdx::simd_abi::max_fixed_size<int>)
+      {
+        vir::transform_indexed(exec_simd.template unroll_by<3>(), data0.begin() + 1, data0.end(),
+                               data1.begin() + 1, [](auto v, auto i) {
+                                 const decltype(v) iv([&](int k) { return T(i[k]); });
+                                 COMPARE(v, iv + T(1));
+                                 return v + iv;
+                               });
+        for (std::size_t i = 1; i < data1.size(); ++i)
+          COMPARE(data1[i], T(2 * i - 1));
+        vir::transform_indexed<std::size_t>(exec_simd.template parallel<2>(), data0, data1, data1,
+                                            [](auto v, auto w, auto i) {
+                                              return w - v - decltype(v)([&](int k) {
+                                                               return T(i[k]);
+                                                             });
+                                            });
+        for (std::size_t i = 1; i < data1.size(); ++i)
+          COMPARE(data1[i], T(-1));
+      }
+
+    vir::transform(exec_simd.template unroll_by<2>().template prefetch<256>(), data0, data1,
+                   [](auto v) { return v + 3; });
+    for (std::size_t i = 0; i < data1.size(); ++i)
+      COMPARE(data1[i], T(i + 3));
+
     vir::transform(exec_simd.template unroll_by<2>(), data0, data1, [](auto v) {
       return v + 1;
     });
@@ -69,6 +109,46 @@ template <typename V>
     for (int x : dataInt)
       COMPARE(x, 3);
 
+    // local classes are not templates, therefore they are simdized as simd_tuple
+    struct Xyz
+    {
+      T x, y, z;
+    };
+    std::vector<Xyz> data3(range_size);
+    vir::transform(exec_simd, data0, data3, [](auto v) {
+      return vir::simdize<Xyz, decltype(v)::size()>(v, v + 1, v + 2);
+    });
+    for (std::size_t i = 0; i < data3.size(); ++i)
+      {
+        COMPARE(data3[i].x, T(i));
+        COMPARE(data3[i].y, T(i + 1));
+        COMPARE(data3[i].z, T(i + 2));
+      }
+
+    if constexpr (N <= vir::stdx::simd_abi::max_fixed_size<int>)
+      {
+        struct Mixed
+        {
+          T a;
+          int b;
+          T c;
+          int d;
+        };
+        std::vector<Mixed> data4(range_size);
+        vir::transform(exec_simd, data0, data4, [](auto v) {
+          using IV = vir::simdize<int, decltype(v)::size()>;
+          const IV iv = vir::stdx::static_simd_cast<IV>(v);
+          return vir::simdize<Mixed, decltype(v)::size()>(v, iv + 1, v + 2, iv + 3);
+        });
+        for (std::size_t i = 0; i < data4.size(); ++i)
+          {
+            COMPARE(data4[i].a, T(i));
+            COMPARE(data4[i].b, int(T(i)) + 1);
+            COMPARE(data4[i].c, T(i + 2));
+            COMPARE(data4[i].d, int(T(i)) + 3);
+          }
+      }
+
 #if defined __clang_major__ and __clang_major__ <= 17
   // Clang 17 fails to compile libstdc++ zip_view code
 #define BAD_COMPILER 1
@@ -78,6 +78,29 @@ template <typename V>
     result = std::transform_reduce(exec_simd.prefer_aligned().template unroll_by<5>(), data0.begin(), data0.end(), data1.begin(), T());
     FUZZY_COMPARE(result, expected);
 
+    // sizes around the thresholds of the unrolled loop with independent accumulators
+    for (int n = 0; n <= N * 10; ++n)
+      {
+        const auto last = data0.begin() + n;
+        const T ref = std::reduce(data0.begin(), last);
+        FUZZY_COMPARE(vir::reduce(exec_simd.template unroll_by<3>(), data0.begin(), last), ref)
+          << "n = " << n;
+        FUZZY_COMPARE(vir::reduce(exec_simd.template unroll_by<4>(), data0.begin(), last), ref)
+          << "n = " << n;
+      }
+
+    result = std::transform_reduce(exec_simd.template prefetch<512>(), data0.begin(), data0.end(), data1.begin(), T());
+    FUZZY_COMPARE(result, expected);
+
+    result = std::transform_reduce(exec_simd.masked_epilogue(), data0.begin(), data0.end(), data1.begin(), T());
+    FUZZY_COMPARE(result, expected);
+
+    result = std::transform_reduce(exec_simd.masked_epilogue().template unroll_by<2>(), data0.begin() + 1, data0.end(), data1.begin() + 1, T(1));
+    FUZZY_COMPARE(result, T(expected + 1));
+
+    result = std::transform_reduce(exec_simd.template unroll_by<4>().template prefetch<1024>(), data0.begin(), data0.end(), data1.begin(), T());
+    FUZZY_COMPARE(result, expected);
+
     result = std::transform_reduce(exec_simd, data2.begin(), data2.end(), data3.begin(), T());
     expected = std::transform_reduce(data2.begin(), data2.end(), data3.begin(), T());
     FUZZY_COMPARE(result, expected);
@@ -88,5 +111,52 @@ template <typename V>
     result = std::transform_reduce(exec_simd, data2.begin(), data2.end(), T(), std::plus<>(),
                                    [](auto v) { return v * v; });
     FUZZY_COMPARE(result, expected);
+
+    if constexpr (std::is_floating_point_v<T>)
+      {
+        // all ones are below the precision of the large values; compensated summation is exact
+        const T large = sizeof(T) == 4 ? T(1e8) : T(1e20);
+        std::vector<T> ones(N * 16 + 3, T(1));
+        ones.front() = large;
+        ones.back() = -large;
+        const T count = T(ones.size() - 2);
+        COMPARE(vir::reduce(exec_simd.compensated(), ones), count);
+        COMPARE(vir::reduce(exec_simd.compensated().template unroll_by<3>(), ones, T(2)),
+                count + T(2));
+        COMPARE(vir::reduce(exec_simd.compensated().template parallel<2>(), ones), count);
+        COMPARE(vir::transform_reduce(exec_simd.compensated(), ones, T(), std::plus<>(),
+                                      [](auto v) { return -v; }),
+                -count);
+
+        // the order of operations does not depend on V, alignment, or unrolling
+        std::vector<T> mixed(N * 16 + 45);
+        for (std::size_t i = 0; i < mixed.size(); ++i)
+          mixed[i] = T(1) / T(i % 13 + 1) * T(i % 2 ? 1 : -3);
+        T ref = T();
+        {
+          constexpr int W = sizeof(T) >= 8 ? 16 : 32;
+          T lanes[W] = {};
+          for (std::size_t i = 0; i < mixed.size(); ++i)
+            lanes[i % W] = T(lanes[i % W] + mixed[i]);
+          for (int n = W / 2; n > 0; n /= 2)
+            for (int j = 0; j < n; ++j)
+              lanes[j] = T(lanes[j] + lanes[j + n]);
+          ref = T(ref + lanes[0]);
+        }
+        COMPARE(vir::reduce(exec_simd.reproducible(), mixed), ref);
+        COMPARE(vir::reduce(exec_simd.reproducible().prefer_aligned().template unroll_by<3>(),
+                            mixed), ref);
+
+        // parallel() splits the range at the same block boundaries as the sequential reduction
+        std::vector<T> large_mixed(3 * 256 * 1024 / sizeof(T) + 17);
+        for (std::size_t i = 0; i < large_mixed.size(); ++i)
+          large_mixed[i] = T(1) / T(i % 13 + 1) * T(i % 2 ? 1 : -3);
+        ref = vir::reduce(exec_simd.reproducible(), large_mixed);
+        COMPARE(vir::reduce(exec_simd.reproducible().template parallel<2>(), large_mixed), ref);
+        COMPARE(vir::reduce(exec_simd.reproducible().template parallel<3>(), large_mixed), ref);
+        COMPARE(vir::reduce(exec_simd.reproducible().prefer_aligned().template unroll_by<3>(),
+                            large_mixed), ref);
+        COMPARE(vir::reduce(exec_simd.reproducible().compensated(), ones), count);
+      }
 #endif // VIR_HAVE_SIMD_EXECUTION
   }
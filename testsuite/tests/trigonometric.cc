@@ -25,4 +25,13 @@ template <typename V>
       {10000}, MAKE_TESTER(acos), MAKE_TESTER(tan), MAKE_TESTER(acosh),
       MAKE_TESTER(asinh), MAKE_TESTER(atanh), MAKE_TESTER(cosh),
       MAKE_TESTER(sinh), MAKE_TESTER(tanh));
+    test_values<V>(
+      {
+#ifdef __STDC_IEC_559__
+	vir::quiet_NaN_v<T>, vir::infinity_v<T>, -vir::infinity_v<T>, -0.,
+	vir::denorm_min_v<T>, vir::norm_min_v<T> / 3,
+#endif
+	+0., vir::norm_min_v<T>, vir::finite_max_v<T>, T(0x1p-30), T(-0x1p-30), T(0x1p-20), 1,
+	2, 3, 4, 5, 6, 7, 8, T(0x1p19), T(-0x1p19), T(0x1p20), T(-0x1p20)},
+      {10000, -1000, 1000}, MAKE_TESTER(sin), MAKE_TESTER(cos));
   }
@@ -0,0 +1,465 @@
+/* SPDX-License-Identifier: LGPL-3.0-or-later */
+/* Copyright © 2024      GSI Helmholtzzentrum fuer Schwerionenforschung GmbH
+ *                       Matthias Kretz <m.kretz@gsi.de>
+ */
+
+#ifndef VIR_AOSOA_VECTOR_H_
+#define VIR_AOSOA_VECTOR_H_
+
+/** \file vir/aosoa_vector.h
+ * \brief A vector of structs that stores blocks of `W` elements as `vir::simdize<T, W>` (array
+ * of structures of arrays).
+ */
+
+#include "simdize.h"
+
+#if VIR_HAVE_SIMDIZE
+#define VIR_HAVE_AOSOA_VECTOR 1
+
+#include <initializer_list>
+#include <iterator>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace vir
+{
+  /**
+   * \brief A sequence container for structs, storing blocks of \p W elements as one
+   * `vir::simdize<T, W>` object each.
+   *
+   * All data members of a block are adjacent in memory, which gives better locality than
+   * vir::soa_vector for kernels that use all data members. `blocks()` is a contiguous range of
+   * `vir::simdize<T, W>`, i.e. iterating over the blocks reads and writes whole vectors without
+   * any permutations. The iterators over the elements load and store chunks of `W` elements as a
+   * copy of the block, such that vir::for_each, vir::transform, and vir::transform_reduce with
+   * vir::execution::simd (and the default chunk size) need no permutations either.
+   *
+   * The last block is padded with value-initialized elements. `operator[]` returns a proxy object
+   * that converts to and is assignable from `T`. Reallocation invalidates all iterators and
+   * references.
+   *
+   * \tparam T A reflectable struct (see vir/struct_reflect.h) with vectorizable data members.
+   * \tparam W The number of elements per block. Defaults to the size of `vir::simdize<T>`.
+   */
+  template <typename T, int W = int(vir::simdize<T>::size())>
+    requires vectorizable_struct<T> and std::default_initializable<T>
+               and requires { typename vir::simdize<T, W>; }
+    class aosoa_vector
+    {
+      static constexpr auto _member_idx_seq
+        = std::make_integer_sequence<int, detail::flat_member_count_v<T>>();
+
+    public:
+      using value_type = T;
+      using size_type = std::size_t;
+      using difference_type = std::ptrdiff_t;
+      using const_reference = T;
+
+      /// The type of one block of \p W elements.
+      using block_type = vir::simdize<T, W>;
+
+      /// The number of elements per block. The capacity is always a multiple of block_size.
+      static constexpr size_type block_size = W;
+
+    private:
+      std::vector<block_type> _blocks;
+
+      size_type _size = 0;
+
+      T
+      _get(size_type i) const
+      {
+        const block_type& b = _blocks[i / W];
+        T r {};
+        [&]<int... Is>(std::integer_sequence<int, Is...>) {
+          ((detail::flat_get<Is>(r) = detail::flat_get<Is>(b)[i % W]), ...);
+        }(_member_idx_seq);
+        return r;
+      }
+
+      void
+      _set(size_type i, const T& x)
+      {
+        block_type& b = _blocks[i / W];
+        [&]<int... Is>(std::integer_sequence<int, Is...>) {
+          ((detail::flat_get<Is>(b)[i % W] = detail::flat_get<Is>(x)), ...);
+        }(_member_idx_seq);
+      }
+
+      /// Adds padding blocks such that \p n elements fit.
+      void
+      _grow_to(size_type n)
+      {
+        const size_type nblocks = (n + W - 1) / W;
+        if (nblocks > _blocks.size())
+          _blocks.resize(nblocks, block_type(T()));
+      }
+
+      template <typename V>
+        VIR_ALWAYS_INLINE V
+        _load(size_type i) const
+        {
+          if constexpr (std::same_as<V, block_type>)
+            {
+              if (i % W == 0)
+                return _blocks[i / W];
+            }
+          V r;
+          [&]<int... Is>(std::integer_sequence<int, Is...>) {
+            ((detail::flat_get<Is>(r) = std::remove_cvref_t<decltype(detail::flat_get<Is>(r))>(
+                [&](auto k) { return detail::flat_get<Is>(_blocks[(i + k) / W])[(i + k) % W]; })
+             ), ...);
+          }(_member_idx_seq);
+          return r;
+        }
+
+      template <typename V>
+        VIR_ALWAYS_INLINE void
+        _store(size_type i, const V& v)
+        {
+          if constexpr (std::same_as<V, block_type>)
+            {
+              if (i % W == 0)
+                {
+                  _blocks[i / W] = v;
+                  return;
+                }
+            }
+          for (size_type k = 0; k < V::size(); ++k)
+            [&]<int... Is>(std::integer_sequence<int, Is...>) {
+              ((detail::flat_get<Is>(_blocks[(i + k) / W])[(i + k) % W]
+                  = detail::flat_get<Is>(v)[k]), ...);
+            }(_member_idx_seq);
+        }
+
+    public:
+      /// Proxy for the element at a given index. Converts to and is assignable from `T`.
+      class reference
+      {
+        friend aosoa_vector;
+
+        aosoa_vector* _vec;
+        size_type _index;
+
+        constexpr
+        reference(aosoa_vector* vec, size_type index) noexcept
+        : _vec(vec), _index(index)
+        {}
+
+      public:
+        reference(const reference&) = default;
+
+        operator T() const
+        { return _vec->_get(_index); }
+
+        const reference&
+        operator=(const T& x) const
+        {
+          _vec->_set(_index, x);
+          return *this;
+        }
+
+        const reference&
+        operator=(const reference& x) const
+        { return *this = T(x); }
+      };
+
+      /**
+       * Random-access iterator over the elements of an aosoa_vector. Additionally loads and
+       * stores chunks of `vir::simdize<T, N>` via simd_load and simd_store, which the algorithms
+       * in vir/simd_execution.h use. Chunks of \p W elements starting at a block boundary are
+       * copies of the block.
+       */
+      template <bool Const>
+        class basic_iterator
+        {
+          friend aosoa_vector;
+
+          template <bool>
+            friend class basic_iterator;
+
+          using _vec_ptr = std::conditional_t<Const, const aosoa_vector*, aosoa_vector*>;
+
+          _vec_ptr _vec = nullptr;
+          std::ptrdiff_t _index = 0;
+
+          constexpr
+          basic_iterator(_vec_ptr vec, std::ptrdiff_t index) noexcept
+          : _vec(vec), _index(index)
+          {}
+
+        public:
+          using value_type = T;
+          using difference_type = std::ptrdiff_t;
+          using reference = std::conditional_t<Const, T, typename aosoa_vector::reference>;
+          using iterator_concept = std::random_access_iterator_tag;
+          using iterator_category = std::input_iterator_tag;
+
+          basic_iterator() = default;
+
+          constexpr
+          basic_iterator(const basic_iterator<not Const>& it) noexcept requires Const
+          : _vec(it._vec), _index(it._index)
+          {}
+
+          /// The index of the element the iterator refers to.
+          constexpr size_type
+          index() const noexcept
+          { return _index; }
+
+          /// Loads the elements `[*this, *this + V::size())`.
+          template <typename V>
+            requires std::same_as<V, vir::simdize<T, V::size()>>
+            VIR_ALWAYS_INLINE V
+            simd_load() const
+            { return _vec->template _load<V>(_index); }
+
+          /// Stores \p v to the elements `[*this, *this + V::size())`.
+          template <typename V>
+            requires (not Const) and std::same_as<V, vir::simdize<T, V::size()>>
+            VIR_ALWAYS_INLINE void
+            simd_store(const V& v) const
+            { _vec->_store(_index, v); }
+
+          reference
+          operator*() const
+          {
+            if constexpr (Const)
+              return _vec->_get(_index);
+            else
+              return {_vec, size_type(_index)};
+          }
+
+          reference
+          operator[](difference_type n) const
+          { return *(*this + n); }
+
+          constexpr basic_iterator&
+          operator++() noexcept
+          {
+            ++_index;
+            return *this;
+          }
+
+          constexpr basic_iterator
+          operator++(int) noexcept
+          {
+            basic_iterator tmp = *this;
+            ++_index;
+            return tmp;
+          }
+
+          constexpr basic_iterator&
+          operator--() noexcept
+          {
+            --_index;
+            return *this;
+          }
+
+          constexpr basic_iterator
+          operator--(int) noexcept
+          {
+            basic_iterator tmp = *this;
+            --_index;
+            return tmp;
+          }
+
+          constexpr basic_iterator&
+          operator+=(difference_type n) noexcept
+          {
+            _index += n;
+            return *this;
+          }
+
+          constexpr basic_iterator&
+          operator-=(difference_type n) noexcept
+          {
+            _index -= n;
+            return *this;
+          }
+
+          friend constexpr basic_iterator
+          operator+(basic_iterator it, difference_type n) noexcept
+          { return it += n; }
+
+          friend constexpr basic_iterator
+          operator+(difference_type n, basic_iterator it) noexcept
+          { return it += n; }
+
+          friend constexpr basic_iterator
+          operator-(basic_iterator it, difference_type n) noexcept
+          { return it -= n; }
+
+          friend constexpr difference_type
+          operator-(const basic_iterator& a, const basic_iterator& b) noexcept
+          { return a._index - b._index; }
+
+          friend constexpr bool
+          operator==(const basic_iterator& a, const basic_iterator& b) noexcept
+          { return a._index == b._index; }
+
+          friend constexpr auto
+          operator<=>(const basic_iterator& a, const basic_iterator& b) noexcept
+          { return a._index <=> b._index; }
+        };
+
+      using iterator = basic_iterator<false>;
+
+      using const_iterator = basic_iterator<true>;
+
+      aosoa_vector() = default;
+
+      /// Constructs \p n value-initialized elements.
+      explicit
+      aosoa_vector(size_type n)
+      { resize(n); }
+
+      /// Constructs \p n copies of \p value.
+      aosoa_vector(size_type n, const T& value)
+      { resize(n, value); }
+
+      aosoa_vector(std::initializer_list<T> init)
+      {
+        reserve(init.size());
+        for (const T& x : init)
+          push_back(x);
+      }
+
+      aosoa_vector(const aosoa_vector&) = default;
+
+      aosoa_vector(aosoa_vector&& rhs) noexcept
+      : _blocks(std::move(rhs._blocks)), _size(std::exchange(rhs._size, 0))
+      { rhs._blocks.clear(); }
+
+      aosoa_vector&
+      operator=(const aosoa_vector&) = default;
+
+      aosoa_vector&
+      operator=(aosoa_vector&& rhs) noexcept
+      {
+        if (this != &rhs)
+          {
+            _blocks = std::move(rhs._blocks);
+            _size = std::exchange(rhs._size, 0);
+            rhs._blocks.clear();
+          }
+        return *this;
+      }
+
+      size_type
+      size() const noexcept
+      { return _size; }
+
+      /// The number of elements in the allocated blocks (a multiple of block_size).
+      size_type
+      capacity() const noexcept
+      { return _blocks.capacity() * W; }
+
+      bool
+      empty() const noexcept
+      { return _size == 0; }
+
+      void
+      reserve(size_type n)
+      { _blocks.reserve((n + W - 1) / W); }
+
+      /// Appends \p x. Reallocates with amortized constant complexity.
+      void
+      push_back(const T& x)
+      {
+        _grow_to(_size + 1);
+        _set(_size, x);
+        ++_size;
+      }
+
+      void
+      pop_back() noexcept
+      { --_size; }
+
+      void
+      clear() noexcept
+      {
+        _blocks.clear();
+        _size = 0;
+      }
+
+      /// Resizes to \p n elements. New elements are value-initialized.
+      void
+      resize(size_type n)
+      { resize(n, T()); }
+
+      /// Resizes to \p n elements. New elements are copies of \p value.
+      void
+      resize(size_type n, const T& value)
+      {
+        _grow_to(n);
+        for (size_type i = _size; i < n; ++i)
+          _set(i, value);
+        _size = n;
+      }
+
+      reference
+      operator[](size_type i) noexcept
+      { return {this, i}; }
+
+      const_reference
+      operator[](size_type i) const
+      { return _get(i); }
+
+      /// The number of blocks, i.e. `size()` divided by block_size, rounded up.
+      size_type
+      block_count() const noexcept
+      { return (_size + W - 1) / W; }
+
+      /// The block containing the elements `[b * W, (b + 1) * W)`.
+      block_type&
+      block(size_type b) noexcept
+      { return _blocks[b]; }
+
+      const block_type&
+      block(size_type b) const noexcept
+      { return _blocks[b]; }
+
+      /**
+       * All blocks containing elements. Elements of the last block after `size()` have
+       * unspecified values (value-initialized unless modified via the block).
+       */
+      std::span<block_type>
+      blocks() noexcept
+      { return {_blocks.data(), block_count()}; }
+
+      std::span<const block_type>
+      blocks() const noexcept
+      { return {_blocks.data(), block_count()}; }
+
+      iterator
+      begin() noexcept
+      { return {this, 0}; }
+
+      const_iterator
+      begin() const noexcept
+      { return {this, 0}; }
+
+      const_iterator
+      cbegin() const noexcept
+      { return {this, 0}; }
+
+      iterator
+      end() noexcept
+      { return {this, difference_type(_size)}; }
+
+      const_iterator
+      end() const noexcept
+      { return {this, difference_type(_size)}; }
+
+      const_iterator
+      cend() const noexcept
+      { return {this, difference_type(_size)}; }
+    };
+} // namespace vir
+
+#endif // VIR_HAVE_SIMDIZE
+#endif // VIR_AOSOA_VECTOR_H_
+
+// vim: et cc=101 tw=100 sw=2 ts=8
@@ -8,6 +8,7 @@
 
 #include "simd.h"
 #include "constexpr_wrapper.h"
+#include <tuple>
 #include <type_traits>
 #if __has_include (<bit>) && __cplusplus >= 202002L
 #include <bit> // for bit_cast
@@ -32,12 +33,6 @@
 #define VIR_SIMD_HAVE_CONSTEXPR_API 1
 #endif
 
-#if defined __GNUC__ and not defined __clang__
-#define VIR_LAMBDA_ALWAYS_INLINE __attribute__((__always_inline__))
-#else
-#define VIR_LAMBDA_ALWAYS_INLINE
-#endif
-
 #ifdef __has_builtin
 // Clang 17 miscompiles permuting loads and stores for simdized types. I was unable to pin down the
 // cause, but it seems highly likely that some __builtin_shufflevector calls get miscompiled. So
@@ -48,6 +43,9 @@
 #if __has_builtin(__builtin_bit_cast)
 #define VIR_HAVE_BUILTIN_BIT_CAST 1
 #endif
+#if __has_builtin(__builtin_nontemporal_store)
+#define VIR_HAVE_BUILTIN_NONTEMPORAL_STORE 1
+#endif
 #endif
 #ifndef VIR_HAVE_WORKING_SHUFFLEVECTOR
 #define VIR_HAVE_WORKING_SHUFFLEVECTOR 0
@@ -55,6 +53,9 @@
 #ifndef VIR_HAVE_BUILTIN_BIT_CAST
 #define VIR_HAVE_BUILTIN_BIT_CAST 0
 #endif
+#ifndef VIR_HAVE_BUILTIN_NONTEMPORAL_STORE
+#define VIR_HAVE_BUILTIN_NONTEMPORAL_STORE 0
+#endif
 
 
 /** \internal
@@ -273,9 +274,9 @@ namespace vir::detail
     unroll2(auto&& fun0, auto&& fun1)
     {
       [&]<int... Is>(std::integer_sequence<int, Is...>) VIR_LAMBDA_ALWAYS_INLINE {
-        [&](auto&&... r0s) VIR_LAMBDA_ALWAYS_INLINE {
-          (fun1(vir::cw<Is>, static_cast<decltype(r0s)>(r0s)), ...);
-        }(fun0(vir::cw<Is>)...);
+        // list-initialization guarantees that fun0 is called in order
+        std::tuple<decltype(fun0(vir::cw<Is>))...> r0s {fun0(vir::cw<Is>)...};
+        (fun1(vir::cw<Is>, std::get<Is>(std::move(r0s))), ...);
       }(std::make_integer_sequence<int, Iterations>());
     }
 #endif
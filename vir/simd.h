@@ -37,6 +37,14 @@
 #endif
 #endif
 
+#ifndef VIR_LAMBDA_ALWAYS_INLINE
+#if defined __GNUC__ and not defined __clang__
+#define VIR_LAMBDA_ALWAYS_INLINE __attribute__((__always_inline__))
+#else
+#define VIR_LAMBDA_ALWAYS_INLINE
+#endif
+#endif
+
 namespace vir::detail
 {
   [[noreturn]] VIR_GNU_COLD VIR_ALWAYS_INLINE void
@@ -188,6 +196,7 @@ namespace vir::stdx
 
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
 #include <cstring>
 #ifdef _GLIBCXX_DEBUG_UB
 #include <cstdio>
@@ -409,6 +418,111 @@ namespace vir::stdx
               typename = std::enable_if_t<
                            is_possible_loadstore_conversion<Ptr, ValueType>::value>>
       using LoadStorePtr = Ptr;
+
+    // fixed_size_alignment
+    // The alignment of fixed_size<N> storage and memory_alignment_v. Only power-of-2 N are
+    // over-aligned (up to 64 Bytes), such that sizeof(simd) remains sizeof(T) * N.
+    template <typename T, int N>
+      inline constexpr size_t fixed_size_alignment
+        = (N & (N - 1)) == 0 ? std::min(sizeof(T) * N, size_t(64)) : alignof(T);
+
+    // max_vec_builtin_bytes
+    // The size of the widest register of the target. Wider GNU vector builtins would be emulated
+    // and, since they are passed and returned differently, lead to -Wpsabi warnings.
+    inline constexpr size_t max_vec_builtin_bytes =
+#ifdef __AVX512F__
+      64;
+#elif defined __AVX__
+      32;
+#else
+      16;
+#endif
+
+    // use_vec_builtin_v
+    // True if simd<T, fixed_size<N>> operations are implemented via GNU vector builtins. This
+    // requires a power-of-2 width that fits into a single register of the target. The storage
+    // remains a plain array, which keeps constexpr element access working.
+    template <typename T, int N>
+      inline constexpr bool use_vec_builtin_v =
+#ifdef __GNUC__
+        N >= 2 and (N & (N - 1)) == 0 and std::is_arithmetic_v<T> and sizeof(T) <= 8
+          and sizeof(T) * N <= max_vec_builtin_bytes;
+#else
+        false;
+#endif
+
+#ifdef __GNUC__
+    template <typename T, int N>
+      using vec_builtin_t [[gnu::vector_size(sizeof(T) * N)]] = T;
+
+    template <int N, typename T>
+      VIR_ALWAYS_INLINE vec_builtin_t<T, N>
+      load_vec_builtin(const T* mem)
+      {
+        vec_builtin_t<T, N> r;
+        __builtin_memcpy(&r, mem, sizeof(r));
+        return r;
+      }
+
+    template <typename V, typename T>
+      VIR_ALWAYS_INLINE void
+      store_vec_builtin(const V& x, T* mem)
+      { __builtin_memcpy(mem, &x, sizeof(V)); }
+
+    // Stores the result of a vector compare (0 or -1 per element) as N bools.
+    template <int N, typename V>
+      VIR_ALWAYS_INLINE void
+      store_vec_builtin_mask(const V& k, bool* mem)
+      {
+        const auto bytes = __builtin_convertvector(k & 1, vec_builtin_t<unsigned char, N>);
+        __builtin_memcpy(mem, &bytes, N);
+      }
+
+    template <size_t Bytes>
+      using mask_int_t = std::conditional_t<
+                           Bytes == 1, signed char, std::conditional_t<
+                                                      Bytes == 2, short, std::conditional_t<
+                                                                           Bytes == 4, int,
+                                                                           long long>>>;
+
+    // Assigns rhs[i] to lhs[i] for all i where k[i] is true, using a vector blend.
+    template <int N, typename T>
+      VIR_ALWAYS_INLINE void
+      masked_assign_vec_builtin(const bool* k, T* lhs, const T* rhs)
+      {
+        using M = vec_builtin_t<mask_int_t<sizeof(T)>, N>;
+        const M kv = __builtin_convertvector(
+                       load_vec_builtin<N>(reinterpret_cast<const unsigned char*>(k)), M);
+        store_vec_builtin(kv ? load_vec_builtin<N>(rhs) : load_vec_builtin<N>(lhs), lhs);
+      }
+#endif
+
+    // Returns a bitmask where bit i is set iff k[i] is true. The bools are read in chunks of 8
+    // and packed via multiplication, such that mask reductions become popcount / countr_zero /
+    // countl_zero on an integer.
+    template <int N>
+      constexpr std::uint64_t
+      bools_to_bitmask(const bool* k)
+      {
+        static_assert(N <= 64);
+#if defined __BYTE_ORDER__ and __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+        if (not __builtin_is_constant_evaluated())
+          {
+            std::uint64_t bits = 0;
+            for (int i = 0; i < N; i += 8)
+              {
+                std::uint64_t chunk = 0;
+                std::memcpy(&chunk, k + i, std::min(8, N - i));
+                bits |= ((chunk * 0x0102040810204080ull) >> 56) << i;
+              }
+            return bits;
+          }
+#endif
+        std::uint64_t bits = 0;
+        for (int i = 0; i < N; ++i)
+          bits |= std::uint64_t(k[i]) << i;
+        return bits;
+      }
   }
 
   namespace simd_abi
@@ -472,6 +586,41 @@ namespace vir::stdx
   template <size_t N>
     inline constexpr overaligned_tag<N> overaligned{};
 
+  namespace detail
+  {
+    template <size_t Alignment, typename T>
+      VIR_ALWAYS_INLINE constexpr T*
+      assume_aligned(T* mem)
+      {
+        if (__builtin_is_constant_evaluated())
+          return mem;
+        vir_simd_precondition(reinterpret_cast<std::uintptr_t>(mem) % Alignment == 0,
+                              "the pointer is not aligned as promised by the load/store flag");
+#ifdef __GNUC__
+        return static_cast<T*>(__builtin_assume_aligned(mem, Alignment));
+#else
+        return mem;
+#endif
+      }
+
+    // Returns mem with the alignment promised by the load/store flag, where VectorAlignment is
+    // the memory_alignment_v of the simd type.
+    template <size_t VectorAlignment, typename T>
+      VIR_ALWAYS_INLINE constexpr T*
+      flags_aligned(T* mem, element_aligned_tag)
+      { return mem; }
+
+    template <size_t VectorAlignment, typename T>
+      VIR_ALWAYS_INLINE constexpr T*
+      flags_aligned(T* mem, vector_aligned_tag)
+      { return assume_aligned<VectorAlignment>(mem); }
+
+    template <size_t VectorAlignment, typename T, size_t N>
+      VIR_ALWAYS_INLINE constexpr T*
+      flags_aligned(T* mem, overaligned_tag<N>)
+      { return assume_aligned<N>(mem); }
+  }
+
   // fwd decls //
   template <class T, class A = simd_abi::compatible<T>>
     class simd
@@ -581,6 +730,16 @@ namespace vir::stdx
     : std::integral_constant<size_t, alignof(bool)>
     {};
 
+  template <class T, int N, class U>
+    struct memory_alignment<simd<T, simd_abi::fixed_size<N>>, detail::Vectorizable<U>>
+    : std::integral_constant<size_t, detail::fixed_size_alignment<U, N>>
+    {};
+
+  template <class T, int N>
+    struct memory_alignment<simd_mask<T, simd_abi::fixed_size<N>>, bool>
+    : std::integral_constant<size_t, detail::fixed_size_alignment<bool, N>>
+    {};
+
   template <class T, class V,
             class = typename std::conjunction<detail::is_vectorizable<T>,
                                               std::disjunction<is_simd<V>, is_simd_mask<V>>>::type>
@@ -765,7 +924,19 @@ namespace vir::stdx
         std::enable_if_t<M == Parts * V::size() && is_simd_mask_v<V>, std::array<V, Parts>>
         split(const simd_mask<typename V::simd_type::value_type, simd_abi::fixed_size<M>>&);
 
-      bool data[N];
+      friend class simd<T, simd_abi::fixed_size<N>>;
+
+      alignas(detail::fixed_size_alignment<bool, N>) bool data[N];
+
+      using _data_type_ = bool[N];
+
+      friend constexpr _data_type_&
+      _data_(simd_mask& x)
+      { return x.data; }
+
+      friend constexpr const _data_type_&
+      _data_(const simd_mask& x)
+      { return x.data; }
 
       template <typename F, size_t... Is>
         constexpr
@@ -773,6 +944,27 @@ namespace vir::stdx
         : data {init(detail::SizeConstant<Is>())...}
         {}
 
+      // Applies op to the bools as GNU vector builtins of bytes if possible, otherwise
+      // element-wise. Thus op must return 0 or 1 for inputs that are 0 or 1.
+      template <typename Op, typename... Args>
+        static constexpr simd_mask
+        _apply(Op op, const Args&... args)
+        {
+#ifdef __GNUC__
+          if constexpr (detail::use_vec_builtin_v<unsigned char, N>)
+            if (not __builtin_is_constant_evaluated())
+              {
+                simd_mask r;
+                detail::store_vec_builtin(
+                  op(detail::load_vec_builtin<N>(
+                       reinterpret_cast<const unsigned char*>(args.data))...), r.data);
+                return r;
+              }
+#endif
+          return simd_mask(std::make_index_sequence<N>(),
+                           [&](size_t i) -> bool { return op(args.data[i]...); });
+        }
+
     public:
       using value_type = bool;
       using reference = bool&;
@@ -811,27 +1003,33 @@ namespace vir::stdx
 
       // load constructor
       template <typename Flags>
-        simd_mask(const value_type* mem, Flags)
-        : simd_mask(std::make_index_sequence<N>(), [mem](size_t i) { return mem[i]; })
-        {}
+        simd_mask(const value_type* mem, Flags f)
+        { copy_from(mem, f); }
 
       template <typename Flags>
-        simd_mask(const value_type* mem, const simd_mask& k, Flags)
+        simd_mask(const value_type* mem, const simd_mask& k, Flags f)
         : simd_mask(std::make_index_sequence<N>(),
-                    [mem, &k](size_t i) { return k[i] ? mem[i] : false; })
+                    [mem = detail::flags_aligned<memory_alignment_v<simd_mask>>(mem, f), &k](
+                      size_t i) { return k[i] ? mem[i] : false; })
         {}
 
       // loads [simd_mask.load]
       template <typename Flags>
         void
-        copy_from(const value_type* mem, Flags)
-        { std::memcpy(data, mem, N * sizeof(bool)); }
+        copy_from(const value_type* mem, Flags f)
+        {
+          std::memcpy(data, detail::flags_aligned<memory_alignment_v<simd_mask>>(mem, f),
+                      N * sizeof(bool));
+        }
 
       // stores [simd_mask.store]
       template <typename Flags>
         void
-        copy_to(value_type* mem, Flags) const
-        { std::memcpy(mem, data, N * sizeof(bool)); }
+        copy_to(value_type* mem, Flags f) const
+        {
+          std::memcpy(detail::flags_aligned<memory_alignment_v<simd_mask>>(mem, f), data,
+                      N * sizeof(bool));
+        }
 
       // scalar access
       constexpr reference
@@ -853,101 +1051,49 @@ namespace vir::stdx
       // negation
       constexpr simd_mask
       operator!() const
-      {
-        simd_mask r {};
-        for (int i = 0; i < N; ++i)
-          r.data[i] = !data[i];
-        return r;
-      }
+      { return _apply([](auto a) VIR_LAMBDA_ALWAYS_INLINE { return a ^ 1; }, *this); }
 
       // simd_mask binary operators [simd_mask.binary]
       friend constexpr simd_mask
       operator&&(const simd_mask& x, const simd_mask& y)
-      {
-        simd_mask r {};
-        for (int i = 0; i < N; ++i)
-          r.data[i] = x.data[i] & y.data[i];
-        return r;
-      }
+      { return _apply([](auto a, auto b) VIR_LAMBDA_ALWAYS_INLINE { return a & b; }, x, y); }
 
       friend constexpr simd_mask
       operator||(const simd_mask& x, const simd_mask& y)
-      {
-        simd_mask r {};
-        for (int i = 0; i < N; ++i)
-          r.data[i] = x.data[i] | y.data[i];
-        return r;
-      }
+      { return _apply([](auto a, auto b) VIR_LAMBDA_ALWAYS_INLINE { return a | b; }, x, y); }
 
       friend constexpr simd_mask
       operator&(const simd_mask& x, const simd_mask& y)
-      {
-        simd_mask r {};
-        for (int i = 0; i < N; ++i)
-          r.data[i] = x.data[i] & y.data[i];
-        return r;
-      }
+      { return _apply([](auto a, auto b) VIR_LAMBDA_ALWAYS_INLINE { return a & b; }, x, y); }
 
       friend constexpr simd_mask
       operator|(const simd_mask& x, const simd_mask& y)
-      {
-        simd_mask r {};
-        for (int i = 0; i < N; ++i)
-          r.data[i] = x.data[i] | y.data[i];
-        return r;
-      }
+      { return _apply([](auto a, auto b) VIR_LAMBDA_ALWAYS_INLINE { return a | b; }, x, y); }
 
       friend constexpr simd_mask
       operator^(const simd_mask& x, const simd_mask& y)
-      {
-        simd_mask r {};
-        for (int i = 0; i < N; ++i)
-          r.data[i] = x.data[i] ^ y.data[i];
-        return r;
-      }
+      { return _apply([](auto a, auto b) VIR_LAMBDA_ALWAYS_INLINE { return a ^ b; }, x, y); }
 
       friend constexpr simd_mask&
       operator&=(simd_mask& x, const simd_mask& y)
-      {
-        for (int i = 0; i < N; ++i)
-          x.data[i] &= y.data[i];
-        return x;
-      }
+      { return x = x & y; }
 
       friend constexpr simd_mask&
       operator|=(simd_mask& x, const simd_mask& y)
-      {
-        for (int i = 0; i < N; ++i)
-          x.data[i] |= y.data[i];
-        return x;
-      }
+      { return x = x | y; }
 
       friend constexpr simd_mask&
       operator^=(simd_mask& x, const simd_mask& y)
-      {
-        for (int i = 0; i < N; ++i)
-          x.data[i] ^= y.data[i];
-        return x;
-      }
+      { return x = x ^ y; }
 
       // simd_mask compares [simd_mask.comparison]
       friend constexpr simd_mask
       operator==(const simd_mask& x, const simd_mask& y)
-      {
-        simd_mask r {};
-        for (int i = 0; i < N; ++i)
-          r.data[i] = x.data[i] == y.data[i];
-        return r;
-      }
+      { return _apply([](auto a, auto b) VIR_LAMBDA_ALWAYS_INLINE { return a ^ b ^ 1; }, x, y); }
 
       friend constexpr simd_mask
       operator!=(const simd_mask& x, const simd_mask& y)
-      {
-        simd_mask r {};
-        for (int i = 0; i < N; ++i)
-          r.data[i] = x.data[i] != y.data[i];
-        return r;
-      }
+      { return _apply([](auto a, auto b) VIR_LAMBDA_ALWAYS_INLINE { return a ^ b; }, x, y); }
     };
 
   // simd_mask reductions [simd_mask.reductions]
@@ -992,63 +1138,83 @@ namespace vir::stdx
       return 0;
     }
 
+  // The fixed_size reductions work on a bitmask (for N <= 64), which turns them into single
+  // compare / popcount / bit scan instructions.
   template <typename T, int N>
     constexpr bool
     all_of(const simd_mask<T, simd_abi::fixed_size<N>>& k) noexcept
     {
-      for (int i = 0; i < N; ++i)
+      if constexpr (N <= 64)
+        return detail::bools_to_bitmask<N>(_data_(k)) == (~std::uint64_t() >> (64 - N));
+      else
         {
-          if (not k[i])
-            return false;
+          for (int i = 0; i < N; ++i)
+            {
+              if (not k[i])
+                return false;
+            }
+          return true;
         }
-      return true;
     }
 
   template <typename T, int N>
     constexpr bool
     any_of(const simd_mask<T, simd_abi::fixed_size<N>>& k) noexcept
     {
-      for (int i = 0; i < N; ++i)
+      if constexpr (N <= 64)
+        return detail::bools_to_bitmask<N>(_data_(k)) != 0;
+      else
         {
-          if (k[i])
-            return true;
+          for (int i = 0; i < N; ++i)
+            {
+              if (k[i])
+                return true;
+            }
+          return false;
         }
-      return false;
     }
 
   template <typename T, int N>
     constexpr bool
     none_of(const simd_mask<T, simd_abi::fixed_size<N>>& k) noexcept
-    {
-      for (int i = 0; i < N; ++i)
-        {
-          if (k[i])
-            return false;
-        }
-      return true;
-    }
+    { return not any_of(k); }
 
   template <typename T, int N>
     constexpr bool
     some_of(const simd_mask<T, simd_abi::fixed_size<N>>& k) noexcept
     {
-      bool last = k[0];
-      for (int i = 1; i < N; ++i)
+      if constexpr (N <= 64)
+        {
+          const std::uint64_t bits = detail::bools_to_bitmask<N>(_data_(k));
+          return bits != 0 and bits != (~std::uint64_t() >> (64 - N));
+        }
+      else
         {
-          if (last != k[i])
-            return true;
+          bool last = k[0];
+          for (int i = 1; i < N; ++i)
+            {
+              if (last != k[i])
+                return true;
+            }
+          return false;
         }
-      return false;
     }
 
   template <typename T, int N>
     constexpr int
     popcount(const simd_mask<T, simd_abi::fixed_size<N>>& k) noexcept
     {
-      int cnt = k[0];
-      for (int i = 1; i < N; ++i)
-        cnt += k[i];
-      return cnt;
+#ifdef __GNUC__
+      if constexpr (N <= 64)
+        return __builtin_popcountll(detail::bools_to_bitmask<N>(_data_(k)));
+      else
+#endif
+        {
+          int cnt = k[0];
+          for (int i = 1; i < N; ++i)
+            cnt += k[i];
+          return cnt;
+        }
     }
 
   template <typename T, int N>
@@ -1056,12 +1222,19 @@ namespace vir::stdx
     find_first_set(const simd_mask<T, simd_abi::fixed_size<N>>& k) noexcept
     {
       vir_simd_precondition(any_of(k), "find_first_set(empty mask) is UB");
-      for (int i = 0; i < N; ++i)
+#ifdef __GNUC__
+      if constexpr (N <= 64)
+        return __builtin_ctzll(detail::bools_to_bitmask<N>(_data_(k)));
+      else
+#endif
         {
-          if (k[i])
-            return i;
+          for (int i = 0; i < N; ++i)
+            {
+              if (k[i])
+                return i;
+            }
+          vir::detail::unreachable();
         }
-      vir::detail::unreachable();
     }
 
   template <typename T, int N>
@@ -1069,12 +1242,19 @@ namespace vir::stdx
     find_last_set(const simd_mask<T, simd_abi::fixed_size<N>>& k) noexcept
     {
       vir_simd_precondition(any_of(k), "find_last_set(empty mask) is UB");
-      for (int i = N - 1; i >= 0; --i)
+#ifdef __GNUC__
+      if constexpr (N <= 64)
+        return 63 - __builtin_clzll(detail::bools_to_bitmask<N>(_data_(k)));
+      else
+#endif
         {
-          if (k[i])
-            return i;
+          for (int i = N - 1; i >= 0; --i)
+            {
+              if (k[i])
+                return i;
+            }
+          vir::detail::unreachable();
         }
-      vir::detail::unreachable();
     }
 
   constexpr bool
@@ -1425,62 +1605,42 @@ namespace vir::stdx
     {
       using Derived = simd<T, simd_abi::fixed_size<N>>;
 
-      constexpr T&
-      d(int i) noexcept
-      { return static_cast<Derived*>(this)->data[i]; }
+      static constexpr bool _vec_shift
+        = sizeof(T) >= sizeof(int) and detail::use_vec_builtin_v<T, N>;
 
-      constexpr const T&
-      d(int i) const noexcept
-      { return static_cast<const Derived*>(this)->data[i]; }
+      constexpr const Derived&
+      d() const noexcept
+      { return *static_cast<const Derived*>(this); }
+
+      template <bool UseVec = detail::use_vec_builtin_v<T, N>, typename Op, typename... Args>
+        static constexpr Derived
+        apply(Op op, const Args&... args)
+        { return Derived::template _apply<UseVec>(op, args...); }
 
     public:
       friend constexpr Derived&
       operator%=(Derived& lhs, const Derived& x)
-      {
-        for (int i = 0; i < N; ++i)
-          lhs.d(i) %= x.d(i);
-        return lhs;
-      }
+      { return lhs = lhs % x; }
 
       friend constexpr Derived&
       operator&=(Derived& lhs, const Derived& x)
-      {
-        for (int i = 0; i < N; ++i)
-          lhs.d(i) &= x.d(i);
-        return lhs;
-      }
+      { return lhs = lhs & x; }
 
       friend constexpr Derived&
       operator|=(Derived& lhs, const Derived& x)
-      {
-        for (int i = 0; i < N; ++i)
-          lhs.d(i) |= x.d(i);
-        return lhs;
-      }
+      { return lhs = lhs | x; }
 
       friend constexpr Derived&
       operator^=(Derived& lhs, const Derived& x)
-      {
-        for (int i = 0; i < N; ++i)
-          lhs.d(i) ^= x.d(i);
-        return lhs;
-      }
+      { return lhs = lhs ^ x; }
 
       friend constexpr Derived&
       operator<<=(Derived& lhs, const Derived& x)
-      {
-        for (int i = 0; i < N; ++i)
-          lhs.d(i) <<= x.d(i);
-        return lhs;
-      }
+      { return lhs = lhs << x; }
 
       friend constexpr Derived&
       operator>>=(Derived& lhs, const Derived& x)
-      {
-        for (int i = 0; i < N; ++i)
-          lhs.d(i) >>= x.d(i);
-        return lhs;
-      }
+      { return lhs = lhs >> x; }
 
       friend constexpr Derived
       operator%(const Derived& x, const Derived& y)
@@ -1488,35 +1648,49 @@ namespace vir::stdx
 
       friend constexpr Derived
       operator&(const Derived& x, const Derived& y)
-      { return Derived([&](size_t i) -> T { return x[i] & y[i]; }); }
+      { return apply([](auto a, auto b) VIR_LAMBDA_ALWAYS_INLINE { return a & b; }, x, y); }
 
       friend constexpr Derived
       operator|(const Derived& x, const Derived& y)
-      { return Derived([&](size_t i) -> T { return x[i] | y[i]; }); }
+      { return apply([](auto a, auto b) VIR_LAMBDA_ALWAYS_INLINE { return a | b; }, x, y); }
 
       friend constexpr Derived
       operator^(const Derived& x, const Derived& y)
-      { return Derived([&](size_t i) -> T { return x[i] ^ y[i]; }); }
+      { return apply([](auto a, auto b) VIR_LAMBDA_ALWAYS_INLINE { return a ^ b; }, x, y); }
 
+      // Shifts of sub-int types are only defined after integer promotion. Therefore vector
+      // builtins are used only if the element type is not promoted.
       friend constexpr Derived
       operator<<(const Derived& x, const Derived& y)
-      { return Derived([&](size_t i) -> T { return x[i] << y[i]; }); }
+      {
+        return apply<_vec_shift>([](auto a, auto b) VIR_LAMBDA_ALWAYS_INLINE { return a << b; },
+                                 x, y);
+      }
 
       friend constexpr Derived
       operator>>(const Derived& x, const Derived& y)
-      { return Derived([&](size_t i) -> T { return x[i] >> y[i]; }); }
+      {
+        return apply<_vec_shift>([](auto a, auto b) VIR_LAMBDA_ALWAYS_INLINE { return a >> b; },
+                                 x, y);
+      }
 
       friend constexpr Derived
       operator<<(const Derived& x, int y)
-      { return Derived([&](size_t i) -> T { return x[i] << y; }); }
+      {
+        return apply<_vec_shift>(
+                 [y](auto a) VIR_LAMBDA_ALWAYS_INLINE { return a << static_cast<T>(y); }, x);
+      }
 
       friend constexpr Derived
       operator>>(const Derived& x, int y)
-      { return Derived([&](size_t i) -> T { return x[i] >> y; }); }
+      {
+        return apply<_vec_shift>(
+                 [y](auto a) VIR_LAMBDA_ALWAYS_INLINE { return a >> static_cast<T>(y); }, x);
+      }
 
       constexpr Derived
       operator~() const
-      { return Derived([&](size_t i) -> T { return ~d(i); }); }
+      { return apply([](auto a) VIR_LAMBDA_ALWAYS_INLINE { return ~a; }, d()); }
     };
 
   // simd (fixed_size)
@@ -1537,7 +1711,7 @@ namespace vir::stdx
         std::tuple<simd<U, simd_abi::deduce_t<U, int(Sizes)>>...>
         split(const simd<U, simd_abi::fixed_size<int((Sizes + ...))>>&);
 
-      T data[N];
+      alignas(detail::fixed_size_alignment<T, N>) T data[N];
 
       using _data_type_ = T[N];
 
@@ -1555,6 +1729,63 @@ namespace vir::stdx
         : data {static_cast<value_type>(init(detail::SizeConstant<Is>()))...}
         {}
 
+      // Applies op to GNU vector builtins if possible, otherwise element-wise.
+      template <bool UseVec = detail::use_vec_builtin_v<T, N>, typename Op, typename... Args>
+        static constexpr simd
+        _apply(Op op, const Args&... args)
+        {
+#ifdef __GNUC__
+          if constexpr (UseVec)
+            if (not __builtin_is_constant_evaluated())
+              {
+                simd r;
+                detail::store_vec_builtin(op(detail::load_vec_builtin<N>(args.data)...), r.data);
+                return r;
+              }
+#endif
+          return simd([&](size_t i) -> T { return op(args.data[i]...); });
+        }
+
+      template <typename Op>
+        static constexpr simd_mask<T, simd_abi::fixed_size<N>>
+        _compare(Op op, const simd& x, const simd& y)
+        {
+#ifdef __GNUC__
+          if constexpr (detail::use_vec_builtin_v<T, N>)
+            if (not __builtin_is_constant_evaluated())
+              {
+                simd_mask<T, simd_abi::fixed_size<N>> r;
+                detail::store_vec_builtin_mask<N>(op(detail::load_vec_builtin<N>(x.data),
+                                                     detail::load_vec_builtin<N>(y.data)),
+                                                  r.data);
+                return r;
+              }
+#endif
+          return simd_mask<T, simd_abi::fixed_size<N>>(
+                   [&](size_t i) { return op(x.data[i], y.data[i]); });
+        }
+
+      template <typename U>
+        constexpr void
+        _load(const U* mem)
+        {
+#ifdef __GNUC__
+          if constexpr (detail::use_vec_builtin_v<T, N> and detail::use_vec_builtin_v<U, N>)
+            if (not __builtin_is_constant_evaluated())
+              {
+                if constexpr (std::is_same_v<T, U>)
+                  __builtin_memcpy(data, mem, sizeof(data));
+                else
+                  detail::store_vec_builtin(
+                    __builtin_convertvector(detail::load_vec_builtin<N>(mem),
+                                            detail::vec_builtin_t<T, N>), data);
+                return;
+              }
+#endif
+          for (int i = 0; i < N; ++i)
+            data[i] = static_cast<T>(mem[i]);
+        }
+
     public:
       using value_type = T;
       using reference = T&;
@@ -1585,9 +1816,7 @@ namespace vir::stdx
                                                 detail::is_higher_integer_rank<value_type, U>>>>
         constexpr
         simd(const simd<U, abi_type>& x)
-        : simd(std::make_index_sequence<N>(),
-               [&x](size_t i) { return static_cast<value_type>(x[i]); })
-        {}
+        { _load(_data_(x)); }
 
       // generator constructor
       template <typename F>
@@ -1601,26 +1830,36 @@ namespace vir::stdx
       // load constructor
       template <typename U, typename Flags>
         constexpr
-        simd(const U* mem, Flags)
-        : simd(std::make_index_sequence<N>(), [mem](size_t i) -> value_type { return mem[i]; })
-        {}
+        simd(const U* mem, Flags f)
+        { _load(detail::flags_aligned<memory_alignment_v<simd, U>>(mem, f)); }
 
       // loads [simd.load]
       template <typename U, typename Flags>
         constexpr void
-        copy_from(const detail::Vectorizable<U>* mem, Flags)
-        {
-          for (int i = 0; i < N; ++i)
-            data[i] = mem[i];
-        }
+        copy_from(const detail::Vectorizable<U>* mem, Flags f)
+        { _load(detail::flags_aligned<memory_alignment_v<simd, U>>(mem, f)); }
 
       // stores [simd.store]
       template <typename U, typename Flags>
         constexpr void
-        copy_to(detail::Vectorizable<U>* mem, Flags) const
+        copy_to(detail::Vectorizable<U>* mem, Flags f) const
         {
+          mem = detail::flags_aligned<memory_alignment_v<simd, U>>(mem, f);
+#ifdef __GNUC__
+          if constexpr (detail::use_vec_builtin_v<T, N> and detail::use_vec_builtin_v<U, N>)
+            if (not __builtin_is_constant_evaluated())
+              {
+                if constexpr (std::is_same_v<T, U>)
+                  __builtin_memcpy(mem, data, sizeof(data));
+                else
+                  detail::store_vec_builtin(
+                    __builtin_convertvector(detail::load_vec_builtin<N>(data),
+                                            detail::vec_builtin_t<U, N>), mem);
+                return;
+              }
+#endif
           for (int i = 0; i < N; ++i)
-            mem[i] = data[i];
+            mem[i] = static_cast<U>(data[i]);
         }
 
       // scalar access
@@ -1643,42 +1882,32 @@ namespace vir::stdx
       // increment and decrement:
       constexpr simd&
       operator++()
-      {
-        for (int i = 0; i < N; ++i)
-          ++data[i];
-        return *this;
-      }
+      { return *this += simd(T(1)); }
 
       constexpr simd
       operator++(int)
       {
         simd r = *this;
-        for (int i = 0; i < N; ++i)
-          ++data[i];
+        *this += simd(T(1));
         return r;
       }
 
       constexpr simd&
       operator--()
-      {
-        for (int i = 0; i < N; ++i)
-          --data[i];
-        return *this;
-      }
+      { return *this -= simd(T(1)); }
 
       constexpr simd
       operator--(int)
       {
         simd r = *this;
-        for (int i = 0; i < N; ++i)
-          --data[i];
+        *this -= simd(T(1));
         return r;
       }
 
       // unary operators
       constexpr mask_type
       operator!() const
-      { return mask_type([&](size_t i) { return !data[i]; }); }
+      { return *this == simd(T()); }
 
       constexpr simd
       operator+() const
@@ -1686,82 +1915,70 @@ namespace vir::stdx
 
       constexpr simd
       operator-() const
-      { return simd([&](size_t i) -> value_type { return -data[i]; }); }
+      { return _apply([](auto a) VIR_LAMBDA_ALWAYS_INLINE { return -a; }, *this); }
 
       // compound assignment [simd.cassign]
       constexpr friend simd&
       operator+=(simd& lhs, const simd& x)
-      {
-        for (int i = 0; i < N; ++i)
-          lhs.data[i] += x.data[i];
-        return lhs;
-      }
+      { return lhs = lhs + x; }
 
       constexpr friend simd&
       operator-=(simd& lhs, const simd& x)
-      {
-        for (int i = 0; i < N; ++i)
-          lhs.data[i] -= x.data[i];
-        return lhs;
-      }
+      { return lhs = lhs - x; }
 
       constexpr friend simd&
       operator*=(simd& lhs, const simd& x)
-      {
-        for (int i = 0; i < N; ++i)
-          lhs.data[i] *= x.data[i];
-        return lhs;
-      }
+      { return lhs = lhs * x; }
 
       constexpr friend simd&
       operator/=(simd& lhs, const simd& x)
-      {
-        for (int i = 0; i < N; ++i)
-          lhs.data[i] /= x.data[i];
-        return lhs;
-      }
+      { return lhs = lhs / x; }
 
       // binary operators [simd.binary]
       constexpr friend simd
       operator+(const simd& x, const simd& y)
-      { return simd([&](size_t i) { return x.data[i] + y.data[i]; }); }
+      { return _apply([](auto a, auto b) VIR_LAMBDA_ALWAYS_INLINE { return a + b; }, x, y); }
 
       constexpr friend simd
       operator-(const simd& x, const simd& y)
-      { return simd([&](size_t i) { return x.data[i] - y.data[i]; }); }
+      { return _apply([](auto a, auto b) VIR_LAMBDA_ALWAYS_INLINE { return a - b; }, x, y); }
 
       constexpr friend simd
       operator*(const simd& x, const simd& y)
-      { return simd([&](size_t i) { return x.data[i] * y.data[i]; }); }
+      { return _apply([](auto a, auto b) VIR_LAMBDA_ALWAYS_INLINE { return a * b; }, x, y); }
 
       constexpr friend simd
       operator/(const simd& x, const simd& y)
-      { return simd([&](size_t i) { return x.data[i] / y.data[i]; }); }
+      {
+        // integer division is not vectorizable
+        return _apply<std::is_floating_point_v<T> and detail::use_vec_builtin_v<T, N>>(
+                 [](auto a, auto b) VIR_LAMBDA_ALWAYS_INLINE { return a / b; }, x, y);
+      }
 
       // compares [simd.comparison]
       constexpr friend mask_type
       operator==(const simd& x, const simd& y)
-      { return mask_type([&](size_t i) { return x.data[i] == y.data[i]; }); }
+      { return _compare([](auto a, auto b) VIR_LAMBDA_ALWAYS_INLINE { return a == b; }, x, y); }
 
       constexpr friend mask_type
       operator!=(const simd& x, const simd& y)
-      { return mask_type([&](size_t i) { return x.data[i] != y.data[i]; }); }
+      { return _compare([](auto a, auto b) VIR_LAMBDA_ALWAYS_INLINE { return a != b; }, x, y); }
 
       constexpr friend mask_type
       operator<(const simd& x, const simd& y)
-      { return mask_type([&](size_t i) { return x.data[i] < y.data[i]; }); }
+      { return _compare([](auto a, auto b) VIR_LAMBDA_ALWAYS_INLINE { return a < b; }, x, y); }
 
       constexpr friend mask_type
       operator<=(const simd& x, const simd& y)
-      { return mask_type([&](size_t i) { return x.data[i] <= y.data[i]; }); }
+      { return _compare([](auto a, auto b) VIR_LAMBDA_ALWAYS_INLINE { return a <= b; }, x, y); }
 
       constexpr friend mask_type
       operator>(const simd& x, const simd& y)
-      { return mask_type([&](size_t i) { return x.data[i] > y.data[i]; }); }
+      { return _compare([](auto a, auto b) VIR_LAMBDA_ALWAYS_INLINE { return a > b; }, x, y); }
 
       constexpr friend mask_type
       operator>=(const simd& x, const simd& y)
-      { return mask_type([&](size_t i) { return x.data[i] >= y.data[i]; }); }
+      { return _compare([](auto a, auto b) VIR_LAMBDA_ALWAYS_INLINE { return a >= b; }, x, y); }
     };
 
   // casts [simd.casts]
@@ -1956,11 +2173,11 @@ namespace vir::stdx
       using value_type =
         typename std::conditional_t<std::is_arithmetic_v<V>, Wrapper, V>::value_type;
 
-      friend const M&
+      friend constexpr const M&
       get_mask(const const_where_expression& x)
       { return x.m_k; }
 
-      friend const V&
+      friend constexpr const V&
       get_lvalue(const const_where_expression& x)
       { return x.m_value; }
 
@@ -2017,11 +2234,11 @@ namespace vir::stdx
       using value_type =
         typename std::conditional_t<std::is_arithmetic_v<V>, Wrapper, V>::value_type;
 
-      friend const M&
+      friend constexpr const M&
       get_mask(const const_where_expression& x)
       { return x.m_k; }
 
-      friend const V&
+      friend constexpr const V&
       get_lvalue(const const_where_expression& x)
       { return x.m_value; }
 
@@ -2067,7 +2284,7 @@ namespace vir::stdx
       static_assert(std::is_same_v<typename M::abi_type, typename V::abi_type>);
       static_assert(M::size() == V::size());
 
-      friend V&
+      friend constexpr V&
       get_lvalue(where_expression& x)
       { return x.m_value; }
 
@@ -2086,6 +2303,31 @@ namespace vir::stdx
             return static_simd_cast<V>(static_cast<Up&&>(x));
         }
 
+      // Assigns op(m_value, rhs) to the elements selected by m_k. With Blend and vector builtins,
+      // op is applied to all elements and the result is blended. Otherwise, only the selected
+      // elements are computed. Thus Blend must only be set if op cannot trap or invoke UB on the
+      // masked-off elements.
+      template <bool Blend, typename Op>
+        constexpr void
+        masked_assign(const V& rhs, Op op)
+        {
+#ifdef __GNUC__
+          if constexpr (Blend and is_simd_v<V>
+                          and detail::use_vec_builtin_v<value_type, int(V::size())>)
+            if (not __builtin_is_constant_evaluated())
+              {
+                detail::masked_assign_vec_builtin<int(V::size())>(
+                  _data_(m_k), _data_(m_value), _data_(V(op(m_value, rhs))));
+                return;
+              }
+#endif
+          for (size_t i = 0; i < V::size(); ++i)
+            {
+              if (m_k[i])
+                m_value[i] = op(m_value[i], rhs[i]);
+            }
+        }
+
     public:
       where_expression(const where_expression&) = delete;
       where_expression& operator=(const where_expression&) = delete;
@@ -2097,14 +2339,34 @@ namespace vir::stdx
       template <typename Up>
         constexpr void
         operator=(Up&& x) &&
-        {
-          const V& rhs = as_simd(x);
-          for (size_t i = 0; i < V::size(); ++i)
-            {
-              if (m_k[i])
-                m_value[i] = rhs[i];
-            }
-        }
+        { masked_assign<true>(as_simd(x), [](const auto&, const auto& b) { return b; }); }
+
+      // Division and shifts may not be evaluated for the masked-off elements. Therefore, only
+      // the remaining operators use masked_assign. Of those, +, -, and * may overflow (UB for
+      // signed integers) or raise floating-point exceptions, so that they are only computed for
+      // all elements if that is harmless.
+      static constexpr bool _blend_arithmetic = std::is_unsigned_v<value_type>
+#ifdef __FAST_MATH__
+                                                  or std::is_floating_point_v<value_type>
+#endif
+        ;
+
+#define SIMD_OP_(op, blend)                                                                \
+      template <typename Up>                                                               \
+        constexpr void                                                                     \
+        operator op##=(Up&& x) &&                                                          \
+        {                                                                                  \
+          masked_assign<blend>(as_simd(x),                                                 \
+                               [](const auto& a, const auto& b) { return a op b; });       \
+        }                                                                                  \
+      static_assert(true)
+      SIMD_OP_(+, _blend_arithmetic);
+      SIMD_OP_(-, _blend_arithmetic);
+      SIMD_OP_(*, _blend_arithmetic);
+      SIMD_OP_(&, true);
+      SIMD_OP_(|, true);
+      SIMD_OP_(^, true);
+#undef SIMD_OP_
 
 #define SIMD_OP_(op)                              \
       template <typename Up>                      \
@@ -2119,14 +2381,8 @@ namespace vir::stdx
             }                                     \
         }                                         \
       static_assert(true)
-      SIMD_OP_(+);
-      SIMD_OP_(-);
-      SIMD_OP_(*);
       SIMD_OP_(/);
       SIMD_OP_(%);
-      SIMD_OP_(&);
-      SIMD_OP_(|);
-      SIMD_OP_(^);
       SIMD_OP_(<<);
       SIMD_OP_(>>);
 #undef SIMD_OP_
@@ -2428,6 +2684,261 @@ namespace vir::stdx
     { return simd<T, A>([&](size_t i) { return std::clamp(v[i], lo[i], hi[i]); }); }
 
   // math
+#ifdef __GNUC__
+  namespace detail
+  {
+    // Vectorized sin, cos, exp, log, and pow for fixed_size simd of float and double, used
+    // whenever simd<T, fixed_size<N>> is implemented via GNU vector builtins and the call is not
+    // constant evaluated. The kernels are the fdlibm algorithms evaluated on vectors of double,
+    // float arguments are converted to double (which makes the float results correctly rounded
+    // except for rare near-halfway cases).
+    //
+    // Every kernel returns its result together with a mask of the lanes it handles. The
+    // remaining lanes (NaN, infinity, tiny or huge arguments, results outside of the normal
+    // range, ...) are computed with the scalar std:: function. Thus special values and
+    // floating-point exceptions are the same as with <cmath>. The domain tests are integer
+    // compares on the bit pattern, which never raise FE_INVALID on NaN.
+    //
+    // Maximum error (measured against a long double reference):
+    // - float: 0.5 ulp + the rounding error of the double result (for pow: plus
+    //   |y·log(x)|·2^-53 relative).
+    // - double: sin, cos, exp, and log < 1 ulp. pow<double> is not vectorized, because a
+    //   ≤1 ulp pow requires log and exp in extended precision.
+    //
+    // The kernels rely on IEEE arithmetic (rounding via 0x1.8p52, compensated sums), which
+    // -ffast-math / -fassociative-math is allowed to fold away. The scalar functions are used
+    // instead.
+    template <typename T, typename A>
+      inline constexpr bool use_vec_math_v = false;
+
+#if not defined __FAST_MATH__ and not defined __ASSOCIATIVE_MATH__
+    template <typename T, int N>
+      inline constexpr bool use_vec_math_v<T, simd_abi::fixed_size<N>>
+        = (std::is_same_v<T, float> or std::is_same_v<T, double>) and use_vec_builtin_v<T, N>;
+#endif
+
+    template <typename V>
+      using vec_math_int_t = decltype(V() < V());
+
+    template <typename V>
+      VIR_ALWAYS_INLINE vec_math_int_t<V>
+      vec_math_bits(const V& x)
+      { return reinterpret_cast<vec_math_int_t<V>>(x); }
+
+    template <typename V, typename I>
+      VIR_ALWAYS_INLINE V
+      vec_math_from_bits(const I& x)
+      { return reinterpret_cast<V>(x); }
+
+    // Returns a mask of the lanes where lo <= |x| <= hi.
+    template <typename V>
+      VIR_ALWAYS_INLINE vec_math_int_t<V>
+      vec_math_abs_in(const V& x, double lo, double hi)
+      {
+        const auto ax = vec_math_bits(x) & 0x7fff'ffff'ffff'ffff;
+        return ax >= __builtin_bit_cast(long long, lo) and ax <= __builtin_bit_cast(long long, hi);
+      }
+
+    // Returns an integer vector holding rint(x) and sets fn to rint(x). Requires |x| < 2^51.
+    template <typename V>
+      VIR_ALWAYS_INLINE vec_math_int_t<V>
+      vec_math_rint(const V& x, V& fn)
+      {
+        constexpr double toint = 0x1.8p52;
+        const V t = x + toint;
+        fn = t - toint;
+        return vec_math_bits(t) - __builtin_bit_cast(long long, toint);
+      }
+
+    // Reduces x to n·π/2 + (y0 + y1) with |y0 + y1| <= π/4 (Cody-Waite with 119 bits of π/2).
+    // The returned mask is false for lanes where the reduction is not accurate enough.
+    template <typename V>
+      VIR_ALWAYS_INLINE vec_math_int_t<V>
+      vec_math_rem_pio2(const V& x, vec_math_int_t<V>& n, V& y0, V& y1)
+      {
+        constexpr double invpio2 = 6.36619772367581382433e-01;
+        constexpr double pio2_1 = 1.57079632673412561417e+00;  // first 33 bits of π/2
+        constexpr double pio2_2 = 6.07710050630396597660e-11;  // next 33 bits
+        constexpr double pio2_2t = 2.02226624879595063154e-21; // π/2 - (pio2_1 + pio2_2)
+        V fn;
+        n = vec_math_rint(x * invpio2, fn);
+        const V t = x - fn * pio2_1; // exact for |n| < 2^20
+        V w = fn * pio2_2;           // exact for |n| < 2^20
+        const V r = t - w;
+        w = fn * pio2_2t - ((t - r) - w);
+        y0 = r - w;
+        y1 = (r - y0) - w;
+        // Cancellation of more than 40 bits needs more bits of π/2 (rare; handled by std::).
+        return (vec_math_bits(y0 * 0x1p40) & 0x7fff'ffff'ffff'ffff)
+                 >= (vec_math_bits(x) & 0x7fff'ffff'ffff'ffff);
+      }
+
+    // sin(x + y) for |x + y| <= π/4
+    template <typename V>
+      VIR_ALWAYS_INLINE V
+      vec_math_kernel_sin(const V& x, const V& y)
+      {
+        constexpr double S1 = -1.66666666666666324348e-01;
+        constexpr double S2 = 8.33333333332248946124e-03;
+        constexpr double S3 = -1.98412698298579493134e-04;
+        constexpr double S4 = 2.75573137070700676789e-06;
+        constexpr double S5 = -2.50507602534068634195e-08;
+        constexpr double S6 = 1.58969099521155010221e-10;
+        const V z = x * x;
+        const V w = z * z;
+        const V r = S2 + z * (S3 + z * S4) + z * w * (S5 + z * S6);
+        const V v = z * x;
+        return x - ((z * (0.5 * y - v * r) - y) - v * S1);
+      }
+
+    // cos(x + y) for |x + y| <= π/4
+    template <typename V>
+      VIR_ALWAYS_INLINE V
+      vec_math_kernel_cos(const V& x, const V& y)
+      {
+        constexpr double C1 = 4.16666666666666019037e-02;
+        constexpr double C2 = -1.38888888888741095749e-03;
+        constexpr double C3 = 2.48015872894767294178e-05;
+        constexpr double C4 = -2.75573143513906633035e-07;
+        constexpr double C5 = 2.08757232129817482790e-09;
+        constexpr double C6 = -1.13596475577881948265e-11;
+        const V z = x * x;
+        V w = z * z;
+        const V r = z * (C1 + z * (C2 + z * C3)) + w * w * (C4 + z * (C5 + z * C6));
+        const V hz = 0.5 * z;
+        w = 1.0 - hz;
+        return w + (((1.0 - w) - hz) + (z * r - x * y));
+      }
+
+    // Computes sin (Cos = false) or cos (Cos = true) for |x| <= 2^19. Tiny |x| are left to std::
+    // because sin(x) = x and cos(x) = 1 are returned without FE_INEXACT.
+    template <typename T, bool Cos, typename V>
+      VIR_ALWAYS_INLINE std::pair<V, vec_math_int_t<V>>
+      vec_math_sincos(const V& x0)
+      {
+        auto ok = vec_math_abs_in(x0, std::is_same_v<T, float> ? 0x1p-12 : 0x1p-26, 0x1p19);
+        const V x = ok ? x0 : 0.;
+        vec_math_int_t<V> n;
+        V y0, y1;
+        ok &= vec_math_rem_pio2(x, n, y0, y1);
+        const V s = vec_math_kernel_sin(y0, y1);
+        const V c = vec_math_kernel_cos(y0, y1);
+        // sin: quadrants 0-3 are s, c, -s, -c; cos: c, -s, -c, s
+        V r;
+        if constexpr (Cos)
+          {
+            r = (n & 1) ? s : c;
+            n += 1;
+          }
+        else
+          r = (n & 1) ? c : s;
+        return {vec_math_from_bits<V>(vec_math_bits(r) ^ ((n & 2) << 62)), ok};
+      }
+
+    // exp(x) for results in the normal range (and |x| >= 2^-54).
+    template <typename T, typename V>
+      VIR_ALWAYS_INLINE std::pair<V, vec_math_int_t<V>>
+      vec_math_exp(const V& x0)
+      {
+        constexpr double invln2 = 1.44269504088896338700e+00;
+        constexpr double ln2hi = 6.93147180369123816490e-01;
+        constexpr double ln2lo = 1.90821492927058770002e-10;
+        constexpr double P1 = 1.66666666666666019037e-01;
+        constexpr double P2 = -2.77777777770155933842e-03;
+        constexpr double P3 = 6.61375632143793436117e-05;
+        constexpr double P4 = -1.65339022054652515390e-06;
+        constexpr double P5 = 4.13813679705723846039e-08;
+        const auto ok = std::is_same_v<T, float> ? vec_math_abs_in(x0, 0x1p-26, 87.)
+                                                 : vec_math_abs_in(x0, 0x1p-54, 708.);
+        const V x = ok ? x0 : 0.;
+        V fk;
+        const auto k = vec_math_rint(x * invln2, fk);
+        const V hi = x - fk * ln2hi;
+        const V lo = fk * ln2lo;
+        const V r = hi - lo;
+        const V t = r * r;
+        const V c = r - t * (P1 + t * (P2 + t * (P3 + t * (P4 + t * P5))));
+        const V y = 1. - ((lo - (r * c) / (2. - c)) - hi);
+        return {y * vec_math_from_bits<V>((k + 1023) << 52), ok};
+      }
+
+    // log(x) for positive normal x.
+    template <typename T, typename V>
+      VIR_ALWAYS_INLINE std::pair<V, vec_math_int_t<V>>
+      vec_math_log(const V& x)
+      {
+        constexpr double ln2hi = 6.93147180369123816490e-01;
+        constexpr double ln2lo = 1.90821492927058770002e-10;
+        constexpr double Lg1 = 6.666666666666735130e-01;
+        constexpr double Lg2 = 3.999999999940941908e-01;
+        constexpr double Lg3 = 2.857142874366239149e-01;
+        constexpr double Lg4 = 2.222219843214978396e-01;
+        constexpr double Lg5 = 1.818357216161805012e-01;
+        constexpr double Lg6 = 1.531383769920937332e-01;
+        constexpr double Lg7 = 1.479819860511658591e-01;
+        constexpr long long sqrt1_2 = 0x3fe6'a09e'667f'3bcd;
+        const auto bits = vec_math_bits(x);
+        const auto ok
+          = bits >= __builtin_bit_cast(long long, double(std::numeric_limits<T>::min()))
+              and bits <= __builtin_bit_cast(long long, double(std::numeric_limits<T>::max()));
+        // x = 2^k·m with m in [√½, √2)
+        const auto ix = (ok ? bits : __builtin_bit_cast(long long, 1.))
+                          + (__builtin_bit_cast(long long, 1.) - sqrt1_2);
+        constexpr double toint = 0x1.8p52;
+        const V dk = vec_math_from_bits<V>((ix >> 52) - 1023 + __builtin_bit_cast(long long, toint))
+                       - toint;
+        const V f = vec_math_from_bits<V>((ix & 0x000f'ffff'ffff'ffff) + sqrt1_2) - 1.;
+        const V hfsq = 0.5 * f * f;
+        const V s = f / (2. + f);
+        const V z = s * s;
+        const V w = z * z;
+        const V R = z * (Lg1 + w * (Lg3 + w * (Lg5 + w * Lg7))) + w * (Lg2 + w * (Lg4 + w * Lg6));
+        return {dk * ln2hi - ((hfsq - (s * (hfsq + R) + dk * ln2lo)) - f), ok};
+      }
+
+    // pow(x, y) = exp(y·log(x)) for positive normal x, finite y, and a normal result. Only
+    // used for float.
+    template <typename T, typename V>
+      VIR_ALWAYS_INLINE std::pair<V, vec_math_int_t<V>>
+      vec_math_pow(const V& x, const V& y)
+      {
+        static_assert(std::is_same_v<T, float>);
+        const auto [lx, ok_x] = vec_math_log<T>(x);
+        const auto ok_y = vec_math_abs_in(y, 0., std::numeric_limits<T>::max());
+        const auto [r, ok] = vec_math_exp<T>((ok_y ? y : 0.) * lx);
+        return {r, ok & ok_x & ok_y};
+      }
+
+    // Applies the kernel to all lanes of args and the scalar function to the lanes the kernel
+    // does not handle. The kernel is invoked on chunks of double no larger than a native vector
+    // register.
+    template <typename T, int N, typename Kernel, typename Scalar, typename... Args>
+      simd<T, simd_abi::fixed_size<N>>
+      vec_math(Kernel kernel, Scalar scalar, const Args&... args)
+      {
+        constexpr int M = std::min(N, int(max_vec_builtin_bytes / sizeof(double)));
+        using VD = vec_builtin_t<double, M>;
+        simd<T, simd_abi::fixed_size<N>> ret;
+        bool done[N];
+        for (int j = 0; j < N; j += M)
+          {
+            const auto [r, ok] = kernel(
+                                   __builtin_convertvector(load_vec_builtin<M>(_data_(args) + j),
+                                                           VD)...);
+            store_vec_builtin(__builtin_convertvector(r, vec_builtin_t<T, M>), _data_(ret) + j);
+            store_vec_builtin_mask<M>(ok, done + j);
+          }
+        for (std::uint64_t todo = ~bools_to_bitmask<N>(done) & (~std::uint64_t() >> (64 - N));
+             todo != 0; todo &= todo - 1)
+          {
+            const int i = __builtin_ctzll(todo);
+            _data_(ret)[i] = scalar(_data_(args)[i]...);
+          }
+        return ret;
+      }
+  }
+#endif
+
 #define SIMD_MATH_1ARG(name, return_temp)                                                          \
   template <typename T, typename A>                                                                \
     constexpr return_temp<T, A>                                                                    \
@@ -2458,6 +2969,23 @@ namespace vir::stdx
          const simd<detail::FloatingPoint<T>, A>& y) noexcept                                      \
     { return return_temp<T, A>([&](size_t i) { return std::name(x[i], y[i]); }); }
 
+#ifdef __GNUC__
+#define SIMD_MATH_1ARG_VEC(name, ...)                                                              \
+  template <typename T, typename A>                                                                \
+    constexpr simd<T, A>                                                                           \
+    name(const simd<detail::FloatingPoint<T>, A>& x) noexcept                                      \
+    {                                                                                              \
+      if constexpr (detail::use_vec_math_v<T, A>)                                                  \
+        if (not __builtin_is_constant_evaluated())                                                 \
+          return detail::vec_math<T, simd_size_v<T, A>>(                                           \
+                   [](const auto& v) { return __VA_ARGS__(v); },                                   \
+                   [](T v) { return std::name(v); }, x);                                           \
+      return simd<T, A>([&x](size_t i) { return std::name(x[i]); });                               \
+    }
+#else
+#define SIMD_MATH_1ARG_VEC(name, ...) SIMD_MATH_1ARG(name, simd)
+#endif
+
 #define SIMD_MATH_3ARG(name, return_temp)                                                          \
   template <typename T, typename A>                                                                \
     constexpr return_temp<T, A>                                                                    \
@@ -2513,7 +3041,40 @@ namespace vir::stdx
   SIMD_MATH_1ARG(tgamma, simd)
   SIMD_MATH_1ARG(lgamma, simd)
 
-  SIMD_MATH_2ARG(pow, simd)
+  namespace detail
+  {
+    template <typename T, typename A>
+      constexpr simd<T, A>
+      simd_pow(const simd<T, A>& x, const simd<T, A>& y)
+      {
+#ifdef __GNUC__
+        if constexpr (std::is_same_v<T, float> and use_vec_math_v<T, A>)
+          if (not __builtin_is_constant_evaluated())
+            return vec_math<T, simd_size_v<T, A>>(
+                     [](const auto& a, const auto& b) { return vec_math_pow<T>(a, b); },
+                     [](T a, T b) { return std::pow(a, b); }, x, y);
+#endif
+        return simd<T, A>([&](size_t i) { return std::pow(x[i], y[i]); });
+      }
+  }
+
+  template <typename T, typename A>
+    constexpr simd<T, A>
+    pow(const simd<detail::FloatingPoint<T>, A>& x, const simd<T, A>& y) noexcept
+    { return detail::simd_pow(x, y); }
+
+  template <typename T, typename A>
+    constexpr simd<T, A>
+    pow(const simd<detail::FloatingPoint<T>, A>& x,
+        const detail::type_identity_t<simd<T, A>>& y) noexcept
+    { return detail::simd_pow(x, y); }
+
+  template <typename T, typename A>
+    constexpr simd<T, A>
+    pow(const detail::type_identity_t<simd<T, A>>& x,
+        const simd<detail::FloatingPoint<T>, A>& y) noexcept
+    { return detail::simd_pow(x, y); }
+
   SIMD_MATH_2ARG(fmod, simd)
   SIMD_MATH_2ARG(remainder, simd)
   SIMD_MATH_2ARG(nextafter, simd)
@@ -2574,8 +3135,8 @@ namespace vir::stdx
   SIMD_MATH_1ARG_FIXED(ilogb, int)
 
   // trig functions
-  SIMD_MATH_1ARG(sin, simd)
-  SIMD_MATH_1ARG(cos, simd)
+  SIMD_MATH_1ARG_VEC(sin, detail::vec_math_sincos<T, false>)
+  SIMD_MATH_1ARG_VEC(cos, detail::vec_math_sincos<T, true>)
   SIMD_MATH_1ARG(tan, simd)
   SIMD_MATH_1ARG(asin, simd)
   SIMD_MATH_1ARG(acos, simd)
@@ -2588,14 +3149,20 @@ namespace vir::stdx
   SIMD_MATH_1ARG(acosh, simd)
   SIMD_MATH_1ARG(atanh, simd)
 
+  // exponential functions
+  SIMD_MATH_1ARG_VEC(exp, detail::vec_math_exp<T>)
+  SIMD_MATH_1ARG(exp2, simd)
+  SIMD_MATH_1ARG(expm1, simd)
+
   // logarithms
-  SIMD_MATH_1ARG(log, simd)
+  SIMD_MATH_1ARG_VEC(log, detail::vec_math_log<T>)
   SIMD_MATH_1ARG(log10, simd)
   SIMD_MATH_1ARG(log1p, simd)
   SIMD_MATH_1ARG(log2, simd)
   SIMD_MATH_1ARG(logb, simd)
 
 #undef SIMD_MATH_1ARG
+#undef SIMD_MATH_1ARG_VEC
 #undef SIMD_MATH_1ARG_FIXED
 #undef SIMD_MATH_2ARG
 #undef SIMD_MATH_3ARG
@@ -21,6 +21,8 @@ namespace vir
 #else
       if constexpr (stdx::simd_size_v<T, A> == 1)
         return k[0];
+      else if constexpr (stdx::simd_size_v<T, A> <= 64)
+        return stdx::detail::bools_to_bitmask<stdx::simd_size_v<T, A>>(_data_(k));
       else
         {
           constexpr int N = stdx::simd_size_v<T, A>;
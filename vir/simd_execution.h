@@ -12,6 +12,8 @@
 
 #include "simd_concepts.h"
 #include "simd_cvt.h"
+#include "simd_iota.h"
+#include "simd_permute.h"
 #include "simdize.h"
 
 #if VIR_HAVE_SIMD_CONCEPTS and VIR_HAVE_SIMDIZE and VIR_HAVE_SIMD_CVT and VIR_HAVE_CONSTEXPR_WRAPPER
@@ -19,12 +21,159 @@
     or __clang_major__ >= 17 or _GLIBCXX_RELEASE < 13
 #define VIR_HAVE_SIMD_EXECUTION 1
 
+#include <atomic>
 #include <ranges>
 #include <cstdint>
+#include <deque>
+#include <limits>
+#include <optional>
+#include <span>
+#include <thread>
 #include <utility>
+#include <vector>
 
 namespace vir
 {
+  /**
+   * Random-access iterator over every `stride()`-th element of an array, e.g. a column of a
+   * row-major matrix. The algorithms in this header load and store ranges of strided_iterator
+   * with gather and scatter instructions.
+   */
+  template <typename T>
+    class strided_iterator
+    {
+      T* _data = nullptr;
+      std::ptrdiff_t _stride = 1;
+      std::ptrdiff_t _index = 0;
+
+    public:
+      using value_type = std::remove_cv_t<T>;
+      using difference_type = std::ptrdiff_t;
+      using reference = T&;
+      using iterator_concept = std::random_access_iterator_tag;
+      using iterator_category = std::random_access_iterator_tag;
+
+      strided_iterator() = default;
+
+      /// Refers to `data[index * stride]`.
+      constexpr
+      strided_iterator(T* data, std::ptrdiff_t stride, std::ptrdiff_t index = 0) noexcept
+      : _data(data), _stride(stride), _index(index)
+      {}
+
+      /// Pointer to the element the iterator refers to. Requires a dereferenceable iterator.
+      constexpr T*
+      base() const noexcept
+      { return _data + _index * _stride; }
+
+      /// Distance between two consecutive elements in units of `T`.
+      constexpr std::ptrdiff_t
+      stride() const noexcept
+      { return _stride; }
+
+      constexpr T&
+      operator*() const noexcept
+      { return _data[_index * _stride]; }
+
+      constexpr T&
+      operator[](difference_type n) const noexcept
+      { return _data[(_index + n) * _stride]; }
+
+      constexpr strided_iterator&
+      operator++() noexcept
+      {
+        ++_index;
+        return *this;
+      }
+
+      constexpr strided_iterator
+      operator++(int) noexcept
+      { return {_data, _stride, _index++}; }
+
+      constexpr strided_iterator&
+      operator--() noexcept
+      {
+        --_index;
+        return *this;
+      }
+
+      constexpr strided_iterator
+      operator--(int) noexcept
+      { return {_data, _stride, _index--}; }
+
+      constexpr strided_iterator&
+      operator+=(difference_type n) noexcept
+      {
+        _index += n;
+        return *this;
+      }
+
+      constexpr strided_iterator&
+      operator-=(difference_type n) noexcept
+      {
+        _index -= n;
+        return *this;
+      }
+
+      friend constexpr strided_iterator
+      operator+(strided_iterator it, difference_type n) noexcept
+      { return it += n; }
+
+      friend constexpr strided_iterator
+      operator+(difference_type n, strided_iterator it) noexcept
+      { return it += n; }
+
+      friend constexpr strided_iterator
+      operator-(strided_iterator it, difference_type n) noexcept
+      { return it -= n; }
+
+      friend constexpr difference_type
+      operator-(const strided_iterator& a, const strided_iterator& b) noexcept
+      { return a._index - b._index; }
+
+      friend constexpr bool
+      operator==(const strided_iterator& a, const strided_iterator& b) noexcept
+      { return a._index == b._index; }
+
+      friend constexpr auto
+      operator<=>(const strided_iterator& a, const strided_iterator& b) noexcept
+      { return a._index <=> b._index; }
+    };
+
+  /**
+   * View of \p size elements starting at \p data with a distance of \p stride elements, e.g.
+   * `vir::strided_view(&matrix[0][col], rows, cols)` for a column of a row-major matrix, or
+   * `vir::strided_view(m.data_handle(), m.extent(0), m.stride(0))` for a 1-D `std::mdspan` with
+   * `layout_stride`.
+   */
+  template <typename T>
+    class strided_view : public std::ranges::view_interface<strided_view<T>>
+    {
+      T* _data = nullptr;
+      std::size_t _size = 0;
+      std::ptrdiff_t _stride = 1;
+
+    public:
+      strided_view() = default;
+
+      constexpr
+      strided_view(T* data, std::size_t size, std::ptrdiff_t stride) noexcept
+      : _data(data), _size(size), _stride(stride)
+      {}
+
+      constexpr strided_iterator<T>
+      begin() const noexcept
+      { return {_data, _stride}; }
+
+      constexpr strided_iterator<T>
+      end() const noexcept
+      { return {_data, _stride, std::ptrdiff_t(_size)}; }
+
+      constexpr std::size_t
+      size() const noexcept
+      { return _size; }
+    };
+
   /// \internal
   namespace detail
   {
@@ -45,6 +194,92 @@ namespace vir
       data_or_ptr(const T* ptr)
       { return ptr; }
 
+    /** \internal
+     * Load/store flag for stores that bypass the cache hierarchy (non-temporal stores). The
+     * address must be aligned as for stdx::vector_aligned. Loads use stdx::vector_aligned.
+     */
+    struct stream_tag {};
+
+    template <typename Flags>
+      VIR_ALWAYS_INLINE constexpr Flags
+      load_flags(Flags f)
+      { return f; }
+
+    VIR_ALWAYS_INLINE constexpr stdx::vector_aligned_tag
+    load_flags(stream_tag)
+    { return {}; }
+
+    /** \internal
+     * Store \p v to the vector-aligned address \p ptr using a non-temporal store instruction if
+     * the target supports one for `sizeof(V)`. Otherwise this is a normal (aligned) store.
+     */
+    template <typename V, typename T>
+      VIR_ALWAYS_INLINE void
+      stream_store(const V& v, T* ptr)
+      {
+        if constexpr (stdx::is_simd_v<V> and std::same_as<typename V::value_type, T>
+                        and std::is_trivially_copyable_v<V> and sizeof(V) == sizeof(T) * V::size()
+                        and (sizeof(V) == 16 or sizeof(V) == 32 or sizeof(V) == 64))
+          {
+#if VIR_HAVE_BUILTIN_NONTEMPORAL_STORE
+            using VBuiltin [[gnu::vector_size(sizeof(V))]] = T;
+            __builtin_nontemporal_store(vir::detail::bit_cast<VBuiltin>(v),
+                                        reinterpret_cast<VBuiltin*>(ptr));
+            return;
+#elif defined __GNUC__ and (defined __x86_64__ or defined __i386__)
+#ifdef __AVX512F__
+            if constexpr (sizeof(V) == 64)
+              {
+                using v8di [[gnu::vector_size(64)]] = long long;
+                return __builtin_ia32_movntdq512(reinterpret_cast<v8di*>(ptr),
+                                                 vir::detail::bit_cast<v8di>(v));
+              }
+#endif
+#ifdef __AVX__
+            if constexpr (sizeof(V) == 32)
+              {
+                using v4di [[gnu::vector_size(32)]] = long long;
+                return __builtin_ia32_movntdq256(reinterpret_cast<v4di*>(ptr),
+                                                 vir::detail::bit_cast<v4di>(v));
+              }
+#endif
+#ifdef __SSE2__
+            if constexpr (sizeof(V) == 16)
+              {
+                using v2di [[gnu::vector_size(16)]] = long long;
+                return __builtin_ia32_movntdq(reinterpret_cast<v2di*>(ptr),
+                                              vir::detail::bit_cast<v2di>(v));
+              }
+#endif
+#endif
+          }
+        v.copy_to(ptr, stdx::vector_aligned);
+      }
+
+    /** \internal
+     * Orders preceding non-temporal stores before all subsequent stores. Required before another
+     * thread may observe the result of stream_store.
+     */
+    VIR_ALWAYS_INLINE void
+    stream_fence()
+    {
+#if defined __GNUC__ and defined __SSE__
+      __builtin_ia32_sfence();
+#else
+      std::atomic_thread_fence(std::memory_order_release);
+#endif
+    }
+
+    template <typename V, typename Flags>
+      VIR_ALWAYS_INLINE constexpr void
+      store_chunk(const V& v, auto ptr, Flags f)
+      {
+        if constexpr (std::same_as<Flags, stream_tag>)
+          stream_store(v, ptr);
+        else
+          v.copy_to(ptr, f);
+      }
+
     // Invokes fun(V&) or fun(const V&) with V copied from ptr.
     // If write_back is true, copy it back to ptr.
     template <typename V, bool write_back = false, typename Flags = stdx::element_aligned_tag,
@@ -55,8 +290,8 @@ namespace vir
         [&](auto... chunks) {
           std::invoke(fun, chunks...);
           if constexpr (write_back)
-            (chunks.copy_to(ptr + (V::size() * Is), f), ...);
-        }(std::conditional_t<write_back, V, const V>(ptr + (V::size() * Is), f)...);
+            (store_chunk(chunks, ptr + (V::size() * Is), f), ...);
+        }(std::conditional_t<write_back, V, const V>(ptr + (V::size() * Is), load_flags(f))...);
       }
 
     template <typename V, typename Flags = stdx::element_aligned_tag, std::size_t... Is>
@@ -355,12 +590,94 @@ case0:
             simd_for_each_epilogue<V, write_back>(fun, leftover, last, f);
       }
 
+    /** \internal
+     * Returns a mask where the first \p N elements are `true`.
+     */
+    template <typename V, int N>
+      VIR_ALWAYS_INLINE constexpr typename V::mask_type
+      first_n_mask()
+      {
+        using T = typename V::value_type;
+        return V([](auto i) { return T(int(i) < N ? 1 : 0); }) == T(1);
+      }
+
+    /** \internal
+     * Returns a mask where the first \p n elements are `true` (\p n < `V::size()`).
+     */
+    template <typename V>
+      VIR_ALWAYS_INLINE constexpr typename V::mask_type
+      first_n_mask(std::size_t n)
+      {
+        using T = typename V::value_type;
+        return V([](auto i) { return T(int(i)); }) < T(n);
+      }
+
+    /** \internal
+     * Loads the first \p n elements at \p ptr into a \p V and zero-initializes the remaining
+     * elements. Memory at and after `ptr + n` is not accessed.
+     */
+    template <typename V, typename Flags = stdx::element_aligned_tag>
+      VIR_ALWAYS_INLINE V
+      masked_load(const typename V::value_type* ptr, std::size_t n, Flags f = {})
+      {
+        V v = 0;
+        where(first_n_mask<V>(n), v).copy_from(ptr, f);
+        return v;
+      }
+
+    /** \internal
+     * Stores the first \p n elements of \p v to \p ptr.
+     */
+    template <typename V, typename Flags>
+      VIR_ALWAYS_INLINE void
+      masked_store(const V& v, typename V::value_type* ptr, std::size_t n, Flags f)
+      { where(first_n_mask<V>(n), v).copy_to(ptr, f); }
+
+    /** \internal
+     * Epilogue replacement for masked_epilogue(): calls \p fun once with a full \p V, holding
+     * the last \p leftover elements of the range followed by zeros. If \p write_back is true,
+     * only the first \p leftover elements are stored back.
+     */
+    template <class V, bool write_back>
+      VIR_ALWAYS_INLINE void
+      simd_for_each_masked_epilogue(auto&& fun, unsigned leftover, auto last, auto f)
+      {
+        const auto ptr = std::to_address(last - leftover);
+        std::conditional_t<write_back, V, const V> v
+          = masked_load<V>(ptr, leftover, load_flags(f));
+        std::invoke(fun, v);
+        if constexpr (write_back)
+          masked_store(v, ptr, leftover, load_flags(f));
+      }
+
     struct simd_policy_prefer_aligned_t {};
 
     struct simd_policy_auto_prologue_t {};
 
     struct simd_policy_assume_matching_size_t {};
 
+    struct simd_policy_stream_stores_t {};
+
+    struct simd_policy_masked_epilogue_t {};
+
+    struct simd_policy_compensated_t {};
+
+    struct simd_policy_reproducible_t {};
+
+    template <int Bytes>
+      struct simd_policy_prefetch_t
+      {};
+
+    template <typename T>
+      struct simd_policy_prefetch_value
+      : std::integral_constant<int, 0>
+      {};
+
+    template <int Bytes>
+      struct simd_policy_prefetch_value<simd_policy_prefetch_t<Bytes>>
+      : std::integral_constant<int, Bytes>
+      {};
+
     template <int N>
       struct simd_policy_unroll_by_t
       {};
@@ -389,6 +706,20 @@ case0:
       : std::integral_constant<int, N>
       {};
 
+    template <int N>
+      struct simd_policy_parallel_t
+      {};
+
+    template <typename T>
+      struct simd_policy_parallel_value
+      : std::integral_constant<int, -1>
+      {};
+
+    template <int N>
+      struct simd_policy_parallel_value<simd_policy_parallel_t<N>>
+      : std::integral_constant<int, N>
+      {};
+
     template <typename T>
       struct is_simd_policy
       : std::false_type
@@ -413,8 +744,113 @@ case0:
       concept simd_execution_iterator = std::contiguous_iterator<It> and requires {
         typename vir::simdize<std::iter_value_t<It>>;
       };
+
+    /** \brief Modelled by random-access iterators that are not contiguous but load chunks of
+     * `vir::simdize<iter_value_t<It>, N>` themselves, e.g. the iterators of vir::soa_vector.
+     *
+     * The chunk starting at `it` is loaded via `it.template simd_load<V>()`. If the iterator is
+     * writable, `it.simd_store(v)` stores a chunk.
+     */
+    template <typename It>
+      concept simd_execution_chunk_iterator
+        = std::random_access_iterator<It> and not std::contiguous_iterator<It>
+            and requires(const It& it) {
+              { it.template simd_load<vir::simdize<std::iter_value_t<It>, 1>>() }
+                -> std::same_as<vir::simdize<std::iter_value_t<It>, 1>>;
+            };
+
+    /** \brief Modelled by random-access iterators that are not contiguous but refer to lvalues of
+     * vectorizable type, e.g. vir::strided_iterator or the iterators of `std::views::stride` and
+     * `std::deque`, and by simd_execution_chunk_iterator.
+     *
+     * for_each, transform, transform_reduce, and reduce load and store such ranges chunk-wise via
+     * gathers and scatters (or the chunk-wise loads and stores of the iterator).
+     */
+    template <typename It>
+      concept simd_execution_gather_iterator
+        = std::random_access_iterator<It> and not std::contiguous_iterator<It>
+            and ((std::is_lvalue_reference_v<std::iter_reference_t<It>>
+                    and vectorizable<std::iter_value_t<It>>)
+                   or simd_execution_chunk_iterator<It>);
+
+    /// Modelled by vir::detail::simd_execution_iterator and simd_execution_gather_iterator.
+    template <typename It>
+      concept simd_execution_gatherable_iterator
+        = simd_execution_iterator<It> or simd_execution_gather_iterator<It>;
+
+    /** \brief Modelled by vir::detail::simd_execution_range and sized ranges of
+     * simd_execution_gather_iterator.
+     */
+    template <typename Rng>
+      concept simd_execution_gatherable_range
+        = simd_execution_range<Rng>
+            or (std::ranges::random_access_range<Rng> and std::ranges::sized_range<Rng>
+                  and simd_execution_gather_iterator<std::ranges::iterator_t<Rng>>);
+
+#ifdef __GLIBCXX__
+    /** \internal
+     * The contiguous segments of [\p first, \p last) in a std::deque, as a random-access range of
+     * `std::span`. Every segment but the first and last is a complete block of the deque.
+     */
+    template <typename T, typename Ref, typename Ptr>
+      constexpr auto
+      iterator_segments(std::_Deque_iterator<T, Ref, Ptr> first,
+                        std::_Deque_iterator<T, Ref, Ptr> last)
+      {
+        using E = std::remove_reference_t<Ref>;
+        using It = std::_Deque_iterator<T, Ref, Ptr>;
+        const std::ptrdiff_t n = first == last ? 0 : last._M_node - first._M_node + 1;
+        return std::views::iota(std::ptrdiff_t(), n)
+                 | std::views::transform([first, last](std::ptrdiff_t k) {
+                     E* const block = std::to_address(first._M_node[k]);
+                     return std::span<E>(k == 0 ? std::to_address(first._M_cur) : block,
+                                         first._M_node + k == last._M_node
+                                           ? std::to_address(last._M_cur)
+                                           : block + It::_S_buffer_size());
+                   });
+      }
+#endif
+
+    namespace segments_impl
+    {
+      void segments() = delete;
+
+      struct segments_fn
+      {
+        template <typename R>
+          requires requires(R& r) { r.segments(); } or requires(R& r) { segments(r); }
+                     or requires(R& r) {
+                       iterator_segments(std::ranges::begin(r), std::ranges::end(r));
+                     }
+          constexpr decltype(auto)
+          operator()(R&& r) const
+          {
+            if constexpr (requires { r.segments(); })
+              return r.segments();
+            else if constexpr (requires { segments(r); })
+              return segments(r);
+            else
+              return iterator_segments(std::ranges::begin(r), std::ranges::end(r));
+          }
+      };
+    } // namespace segments_impl
   } // namespace detail
 
+  /**
+   * Customization point for ranges that consist of contiguous segments, e.g. a ring buffer
+   * (two segments) or a chunked log. `vir::segments(r)` returns
+   *
+   * 1. `r.segments()` if that expression is valid, otherwise
+   * 2. `segments(r)` found via argument-dependent lookup, otherwise
+   * 3. the blocks of `std::deque` (and iterator pairs thereof) that `r` refers to (libstdc++
+   *    only).
+   *
+   * The result must be a forward range of sized contiguous ranges (e.g. `std::span`) of a
+   * vectorizable value-type. for_each, transform, transform_reduce, and reduce process every
+   * segment with the contiguous simd implementation.
+   */
+  inline constexpr detail::segments_impl::segments_fn segments {};
+
   /**
    * Equivalent to the `std::execution` namespace.
    */
@@ -433,12 +869,33 @@ case0:
         static constexpr bool _assume_matching_size
           = (false or ... or std::same_as<Options, detail::simd_policy_assume_matching_size_t>);
 
+        static constexpr bool _stream_stores
+          = (false or ... or std::same_as<Options, detail::simd_policy_stream_stores_t>);
+
+        static constexpr int _prefetch
+          = (0 + ... + detail::simd_policy_prefetch_value<Options>::value);
+
+        static constexpr bool _masked_epilogue
+          = (false or ... or std::same_as<Options, detail::simd_policy_masked_epilogue_t>);
+
+        static constexpr bool _compensated
+          = (false or ... or std::same_as<Options, detail::simd_policy_compensated_t>);
+
+        static constexpr bool _reproducible
+          = (false or ... or std::same_as<Options, detail::simd_policy_reproducible_t>);
+
         static constexpr int _unroll_by
           = (0 + ... + detail::simd_policy_unroll_value<Options>::value);
 
         static constexpr int _size
           = (0 + ... + detail::simd_policy_size_value<Options>::value);
 
+        static constexpr bool _parallel
+          = (false or ... or (detail::simd_policy_parallel_value<Options>::value >= 0));
+
+        static constexpr int _threads
+          = (0 + ... + std::max(0, detail::simd_policy_parallel_value<Options>::value));
+
         // The following three are mutually exclusive:
 
         /**
@@ -460,7 +917,7 @@ case0:
          */
         static constexpr simd_policy<Options..., detail::simd_policy_auto_prologue_t>
         auto_prologue() requires(not _prefers_aligned and not _auto_prologue
-                                   and not _assume_matching_size)
+                                   and not _assume_matching_size and not _stream_stores)
         { return {}; }
 
         /**
@@ -472,7 +929,60 @@ case0:
          */
         static constexpr simd_policy<Options..., detail::simd_policy_assume_matching_size_t>
         assume_matching_size() requires(not _prefers_aligned and not _auto_prologue
-                                          and not _assume_matching_size)
+                                          and not _assume_matching_size and not _stream_stores
+                                          and not _masked_epilogue)
+        { return {}; }
+
+        /**
+         * Store the output of `transform` and the write-back of `for_each` with non-temporal
+         * stores, bypassing the caches. This avoids reading the destination cache lines before
+         * writing them and is therefore more efficient if the output is much larger than the
+         * last-level cache and not read again soon. Implies prefer_aligned() for the output range
+         * (non-temporal stores require aligned addresses). Stores in the prologue and epilogue use
+         * regular stores. The algorithm ends with a store fence.
+         */
+        static constexpr simd_policy<Options..., detail::simd_policy_stream_stores_t>
+        stream_stores() requires(not _auto_prologue and not _assume_matching_size
+                                   and not _stream_stores)
+        { return {}; }
+
+        /**
+         * Process the elements after the last full chunk with a single call of the user-supplied
+         * function, using masked loads and stores, instead of a sequence of calls with smaller
+         * `simd` types. This reduces code size and the number of branches for short ranges. The
+         * elements of the last chunk that are not part of the range are zero-initialized and
+         * not stored. Supported by `for_each`, `transform`, and `transform_reduce`/`reduce` (if the
+         * range contains at least one full chunk) whenever all chunks are `simd` objects
+         * (otherwise the default epilogue is used).
+         */
+        static constexpr simd_policy<Options..., detail::simd_policy_masked_epilogue_t>
+        masked_epilogue() requires(not _masked_epilogue and not _assume_matching_size)
+        { return {}; }
+
+        /**
+         * Use compensated (Neumaier) summation in `reduce` and `transform_reduce` if the reduction
+         * is `std::plus` over a floating-point type. Every `simd` lane keeps its own compensation
+         * term, which is combined at the end. The error of the result then does not grow with the
+         * range size, at the cost of four additional floating-point operations per chunk. Use
+         * `unroll_by` to hide their latency. Other reductions ignore this modifier. (Do not compile
+         * with `-ffast-math` or `-fassociative-math`, which remove the compensation.)
+         */
+        static constexpr simd_policy<Options..., detail::simd_policy_compensated_t>
+        compensated() requires(not _compensated)
+        { return {}; }
+
+        /**
+         * Make `reduce` and `transform_reduce` over arithmetic types use a canonical order of
+         * operations, which does not depend on the target ISA, the alignment of the range, or other
+         * modifiers: Element `i` of the range is reduced into element `i % W` of an accumulator of
+         * fixed width `W` (32, or 16 for 8-byte types), in order, within blocks of a fixed number
+         * of elements. The block accumulators are reduced in order and their elements are then
+         * reduced pairwise. The result is thus bitwise identical on all targets and with or without
+         * `parallel()` (as long as the compiler does not contract operations into FMAs
+         * differently; use `-ffp-contract=off`).
+         */
+        static constexpr simd_policy<Options..., detail::simd_policy_reproducible_t>
+        reproducible() requires(not _reproducible)
         { return {}; }
 
         /**
@@ -486,6 +996,10 @@ case0:
          * and therefore still call the function with a single `simd` (to avoid the need for
          * returning an `array` or `tuple` of `simd_mask`). Such algorithms will still make use of
          * unrolling inside their implementation.
+         *
+         * `reduce` and `transform_reduce` keep `M` independent `simd` accumulators, which are
+         * combined only after the main loop. Thus the loop is not limited by the latency of the
+         * reduction operation (e.g. FP add), but by throughput.
          */
         template <int N>
           static constexpr simd_policy<Options..., detail::simd_policy_unroll_by_t<N>>
@@ -506,6 +1020,38 @@ case0:
             static_assert(N > 0);
             return {};
           }
+
+        /**
+         * Prefetch the data `Bytes` bytes ahead of the current position in the main loop of
+         * `for_each`, `transform`, and `transform_reduce`/`reduce`. This applies to all input
+         * ranges and the output range (except for non-temporal stores). Use this if the hardware
+         * prefetcher does not keep up, e.g. because many ranges are read concurrently. Good
+         * distances are typically a few hundred to a few thousand bytes.
+         */
+        template <int Bytes>
+          static constexpr simd_policy<Options..., detail::simd_policy_prefetch_t<Bytes>>
+          prefetch() requires(_prefetch == 0)
+          {
+            static_assert(Bytes > 0);
+            return {};
+          }
+
+        /**
+         * Split the range into blocks and execute the algorithm on `N` threads (or
+         * `std::thread::hardware_concurrency()` threads if `N` is 0). Each block is processed with
+         * the same vectorized implementation as without this modifier. User-supplied functions
+         * are called concurrently and thus must not introduce data races.
+         *
+         * Supported by `for_each`, `transform`, `transform_reduce`, `reduce`, and `count_if`. Other
+         * algorithms ignore this modifier.
+         */
+        template <int N = 0>
+          static constexpr simd_policy<Options..., detail::simd_policy_parallel_t<N>>
+          parallel() requires(not _parallel)
+          {
+            static_assert(N >= 0);
+            return {};
+          }
       };
 
     /**
@@ -535,6 +1081,169 @@ case0:
       : std::true_type
       {};
 
+    template <typename Policy, typename Done = execution::simd_policy<>>
+      struct sequential_policy;
+
+    template <typename... Done>
+      struct sequential_policy<execution::simd_policy<>, execution::simd_policy<Done...>>
+      { using type = execution::simd_policy<Done...>; };
+
+    template <typename Option, typename... Options, typename... Done>
+      struct sequential_policy<execution::simd_policy<Option, Options...>,
+                               execution::simd_policy<Done...>>
+      : sequential_policy<execution::simd_policy<Options...>,
+                          std::conditional_t<(simd_policy_parallel_value<Option>::value >= 0),
+                                             execution::simd_policy<Done...>,
+                                             execution::simd_policy<Done..., Option>>>
+      {};
+
+    /// The policy \p Policy without the parallel() modifier.
+    template <simd_execution_policy Policy>
+      using sequential_policy_t = typename sequential_policy<Policy>::type;
+
+    /** \internal
+     * Number of elements of type \p T per block of a parallel algorithm. Blocks are large enough
+     * to amortize the scheduling overhead and small enough to balance the load between threads.
+     * The block size is a multiple of \p chunk, such that all blocks have the same alignment.
+     */
+    template <typename T, std::size_t chunk>
+      inline constexpr std::size_t parallel_block_size
+        = std::max(chunk, (std::size_t(256) * 1024 / sizeof(T)) / chunk * chunk);
+
+    /** \internal
+     * Calls `fun(block_index, begin, end)` for all blocks of size \p block_size in [0, \p n).
+     * The blocks are distributed dynamically over \p nthreads threads (the calling thread
+     * included). If \p nthreads is 0, the number of hardware threads is used.
+     *
+     * \returns The number of blocks.
+     */
+    template <typename F>
+      std::size_t
+      parallel_blocks(std::size_t n, std::size_t block_size, unsigned nthreads, F&& fun)
+      {
+        const std::size_t nblocks = (n + block_size - 1) / block_size;
+        if (nthreads == 0)
+          nthreads = std::max(1u, std::thread::hardware_concurrency());
+        nthreads = unsigned(std::min<std::size_t>(nthreads, nblocks));
+        std::atomic<std::size_t> next_block = 0;
+        auto work = [&] {
+          for (std::size_t b = next_block++; b < nblocks; b = next_block++)
+            fun(b, b * block_size, std::min(n, (b + 1) * block_size));
+        };
+        if (nthreads <= 1)
+          work();
+        else
+          {
+            std::vector<std::jthread> threads;
+            threads.reserve(nthreads - 1);
+            for (unsigned i = 1; i < nthreads; ++i)
+              threads.emplace_back(work);
+            work();
+          }
+        return nblocks;
+      }
+
+    /** \brief Modelled by forward ranges of segments that model simd_execution_range and
+     * std::ranges::sized_range, i.e. the return type of vir::segments.
+     */
+    template <typename Segs>
+      concept simd_execution_segments
+        = std::ranges::forward_range<Segs>
+            and std::ranges::sized_range<std::ranges::range_reference_t<Segs>>
+            and simd_execution_range<std::ranges::range_reference_t<Segs>>;
+
+    /// Modelled by the iterators of std::deque (libstdc++).
+    template <typename It>
+      concept simd_execution_segmented_iterator = requires(It it) {
+        { iterator_segments(it, it) } -> simd_execution_segments;
+      };
+
+    /// Modelled by non-contiguous ranges with contiguous segments via vir::segments.
+    template <typename Rng>
+      concept simd_execution_segmented_range
+        = std::ranges::range<Rng> and not std::ranges::contiguous_range<Rng>
+            and requires(Rng& r) { { vir::segments(r) } -> simd_execution_segments; };
+
+    /// Modelled by simd_execution_gatherable_range and simd_execution_segmented_range.
+    template <typename Rng>
+      concept simd_execution_input_range
+        = simd_execution_gatherable_range<Rng> or simd_execution_segmented_range<Rng>;
+
+    /** \internal
+     * Calls `fun(run, first, last, offset)` for runs [first, last) of consecutive segments of
+     * \p segs, where `offset` is the number of elements in the segments before `first`. Returns
+     * the results of all runs folded over \p combine, in order.
+     *
+     * All segments form a single run, unless ExecutionPolicy is parallel and \p segs is a sized
+     * random-access range. Then every run holds about parallel_block_size elements and the runs
+     * are distributed over threads.
+     */
+    template <simd_execution_policy ExecutionPolicy, typename Segs, typename F,
+              typename Combine = std::nullptr_t>
+      constexpr auto
+      segment_runs(Segs&& segs, F&& fun, [[maybe_unused]] Combine combine = {})
+      {
+        const auto first = std::ranges::begin(segs);
+        using R = decltype(fun(std::size_t(), first, first, std::size_t()));
+        if constexpr (ExecutionPolicy::_parallel and std::ranges::random_access_range<Segs>
+                        and std::ranges::sized_range<Segs>)
+          if (not std::is_constant_evaluated() and std::ranges::size(segs) > 1)
+            {
+              using T = std::ranges::range_value_t<std::ranges::range_reference_t<Segs>>;
+              const std::size_t nseg = std::ranges::size(segs);
+              std::size_t n = 0;
+              for (std::size_t k = 0; k < nseg; ++k)
+                n += std::ranges::size(first[k]);
+              const std::size_t per_segment = std::max(std::size_t(1), n / nseg);
+              const std::size_t per_run
+                = std::max(std::size_t(1), parallel_block_size<T, 1> / per_segment);
+              const std::size_t nruns = (nseg + per_run - 1) / per_run;
+              std::vector<std::size_t> offset(nruns);
+              for (std::size_t k = 0, sum = 0; k < nseg; ++k)
+                {
+                  if (k % per_run == 0)
+                    offset[k / per_run] = sum;
+                  sum += std::ranges::size(first[k]);
+                }
+              if constexpr (std::is_void_v<R>)
+                {
+                  parallel_blocks(nseg, per_run, ExecutionPolicy::_threads,
+                                  [&](std::size_t b, std::size_t begin, std::size_t end) {
+                                    fun(b, first + begin, first + end, offset[b]);
+                                  });
+                  return;
+                }
+              else
+                {
+                  std::vector<R> result(nruns);
+                  parallel_blocks(nseg, per_run, ExecutionPolicy::_threads,
+                                  [&](std::size_t b, std::size_t begin, std::size_t end) {
+                                    result[b] = fun(b, first + begin, first + end, offset[b]);
+                                  });
+                  R acc = std::move(result[0]);
+                  for (std::size_t b = 1; b < nruns; ++b)
+                    acc = combine(std::move(acc), std::move(result[b]));
+                  return acc;
+                }
+            }
+        return fun(0, first, std::ranges::end(segs), 0);
+      }
+
+    template <simd_execution_policy ExecutionPolicy, typename Segs, typename F>
+      constexpr void
+      segmented_for_each(Segs&& segs, F& fun);
+
+    template <simd_execution_policy ExecutionPolicy, typename Segs, typename OutIt,
+              typename Operation, typename... It2>
+      constexpr OutIt
+      segmented_transform(Segs&& segs, OutIt d_first, Operation op, It2... first2);
+
+    template <simd_execution_policy ExecutionPolicy, typename Segs, typename T,
+              typename BinaryReductionOp, typename TransformOp, typename... It2>
+      constexpr T
+      segmented_transform_reduce(Segs&& segs, T init, BinaryReductionOp reduce_op,
+                                 TransformOp transform_op, It2... first2);
+
     template <typename V, typename T = typename V::value_type>
       struct memory_alignment
       : vir::constexpr_wrapper<alignof(T)>
@@ -571,7 +1280,11 @@ case0:
               and memory_alignment_v<V> > sizeof(T);
 
         static constexpr bool use_aligned_loadstore
-          = ExecutionPolicy::_prefers_aligned and prologue_is_possible;
+          = (ExecutionPolicy::_prefers_aligned or ExecutionPolicy::_stream_stores)
+              and prologue_is_possible;
+
+        static constexpr bool use_stream_stores
+          = ExecutionPolicy::_stream_stores and use_aligned_loadstore;
 
         static constexpr bool maybe_execute_prologue_anyway
           = ExecutionPolicy::_auto_prologue and prologue_is_possible;
@@ -579,6 +1292,9 @@ case0:
         static constexpr std::conditional_t<use_aligned_loadstore, stdx::vector_aligned_tag,
                                             stdx::element_aligned_tag> flags{};
 
+        static constexpr std::conditional_t<use_stream_stores, stream_tag,
+                                            std::remove_const_t<decltype(flags)>> store_flags{};
+
         constexpr void
         operator()(std::size_t& remaining, auto iterator_to_align, auto&& do_prologue,
                    auto&... iterators_to_advance) const
@@ -594,9 +1310,18 @@ case0:
               if (misaligned_by_bytes == 0)
                 return;
               const auto misaligned_by_elements = misaligned_by_bytes / sizeof(T);
-              const auto to_process = max_misalignment - misaligned_by_elements;
+              auto to_process = max_misalignment - misaligned_by_elements;
               if constexpr (use_aligned_loadstore)
-                do_prologue(max_misalignment, to_process);
+                {
+                  // If the range ends before the next aligned address, only process the leading
+                  // chunks that fit. Their sizes are the lowest set bits of to_process, which
+                  // leaves the iterator aligned for the epilogue (it uses decreasing chunk sizes).
+                  while (to_process > remaining)
+                    to_process &= ~std::bit_floor(to_process);
+                  if (to_process == 0)
+                    return;
+                  do_prologue(max_misalignment, to_process);
+                }
               else if (remaining * sizeof(T) > 4000
                          or (to_process & remaining) == to_process) // prologue replaces epilogue
                 do_prologue(max_misalignment, to_process);
@@ -609,32 +1334,122 @@ case0:
       };
 
     /** \internal
-     * Given an iterator type \p It, generate corresponding simd type for the given \p size (can be
-     * 0 for default).
+     * Prefetch the \p N elements \p Distance bytes after each of \p its (one prefetch per cache
+     * line). Pass 1 for \p RW to prefetch for writing. Does nothing if \p Distance is 0.
      */
-    template <typename It, int size>
-      using iter_simdize_t = vir::simdize<std::iter_value_t<It>, size>;
-
-    template <typename... Its>
-      constexpr auto
-      simdized_load_and_invoke(auto op, vir::constexpr_value auto size, Its... its)
+    template <int Distance, std::size_t N, int RW = 0, typename... Its>
+      VIR_ALWAYS_INLINE void
+      prefetch_ahead(Its... its)
       {
-        return std::invoke(
-                 op, iter_simdize_t<Its, size>(std::to_address(its), stdx::element_aligned)...);
+        if constexpr (Distance > 0)
+          ([&](auto ptr) VIR_LAMBDA_ALWAYS_INLINE {
+            constexpr std::size_t cache_line = 64;
+            constexpr std::size_t bytes = N * sizeof(*ptr);
+            // uintptr_t arithmetic, because the prefetch address may lie outside of the range
+            const std::uintptr_t addr = reinterpret_cast<std::uintptr_t>(ptr) + Distance;
+            for (std::size_t offset = 0; offset < bytes; offset += cache_line)
+              __builtin_prefetch(reinterpret_cast<const void*>(addr + offset), RW);
+          }(std::to_address(its)), ...);
       }
 
-    template <typename It0, typename... Its>
-      constexpr auto
-      simdized_load_flag1_and_invoke(auto op, vir::constexpr_value auto size, auto flag0, It0 it0,
-                                     Its... its)
-      {
-        return std::invoke(
-                 op, iter_simdize_t<It0, size>(std::to_address(it0), flag0),
-                 iter_simdize_t<Its, size>(std::to_address(its), stdx::element_aligned)...);
-      }
+    template <typename It>
+      inline constexpr bool is_strided_iterator = false;
 
-    template <typename R, typename... Ts>
-      VIR_ALWAYS_INLINE constexpr void
+    template <typename T>
+      inline constexpr bool is_strided_iterator<vir::strided_iterator<T>> = true;
+
+    /** \internal
+     * Whether the offsets of the elements of a `V` chunk of a strided range with stride \p stride
+     * fit into `int`, the index type for gather and scatter.
+     */
+    template <typename V>
+      VIR_ALWAYS_INLINE constexpr bool
+      strided_index_fits(std::ptrdiff_t stride)
+      {
+        return V::size() <= stdx::simd_abi::max_fixed_size<int>
+                 and stride <= std::numeric_limits<int>::max() / std::ptrdiff_t(V::size())
+                 and stride >= std::numeric_limits<int>::min() / std::ptrdiff_t(V::size());
+      }
+
+    template <typename V>
+      VIR_ALWAYS_INLINE constexpr auto
+      strided_index(std::ptrdiff_t stride)
+      {
+        using I = stdx::rebind_simd_t<int, V>;
+        return vir::iota_v<I> * int(stride);
+      }
+
+    /** \internal
+     * Loads the chunk `[it, it + V::size())`. Contiguous iterators use a vector load with flags
+     * \p f, strided iterators a gather, chunk iterators their own simd_load, and other iterators
+     * load element by element.
+     */
+    template <typename V, typename It, typename Flags = stdx::element_aligned_tag>
+      VIR_ALWAYS_INLINE constexpr V
+      load_chunk(It it, Flags f = {})
+      {
+        if constexpr (std::contiguous_iterator<It>)
+          return V(std::to_address(it), f);
+        else if constexpr (simd_execution_chunk_iterator<It>)
+          return it.template simd_load<V>();
+        else
+          {
+            using T = typename V::value_type;
+            if constexpr (is_strided_iterator<It> and V::size() > 1
+                            and V::size() <= stdx::simd_abi::max_fixed_size<int>)
+              if (strided_index_fits<V>(it.stride()))
+                return vir::simd_gather<V>(it.base(), strided_index<V>(it.stride()));
+            return V([&](int i) { return static_cast<T>(it[i]); });
+          }
+      }
+
+    /** \internal
+     * Stores \p v to `[it, it + V::size())`, the counterpart of load_chunk.
+     */
+    template <typename V, typename It, typename Flags = stdx::element_aligned_tag>
+      VIR_ALWAYS_INLINE constexpr void
+      store_chunk_at(const V& v, It it, Flags f = {})
+      {
+        if constexpr (std::contiguous_iterator<It>)
+          store_chunk(v, std::to_address(it), f);
+        else if constexpr (simd_execution_chunk_iterator<It>)
+          it.simd_store(v);
+        else
+          {
+            if constexpr (is_strided_iterator<It> and V::size() > 1
+                            and V::size() <= stdx::simd_abi::max_fixed_size<int>)
+              if (strided_index_fits<V>(it.stride()))
+                return vir::simd_scatter(v, it.base(), strided_index<V>(it.stride()));
+            for (std::size_t i = 0; i < V::size(); ++i)
+              it[i] = v[i];
+          }
+      }
+
+    /** \internal
+     * Given an iterator type \p It, generate corresponding simd type for the given \p size (can be
+     * 0 for default).
+     */
+    template <typename It, int size>
+      using iter_simdize_t = vir::simdize<std::iter_value_t<It>, size>;
+
+    template <typename... Its>
+      constexpr auto
+      simdized_load_and_invoke(auto op, vir::constexpr_value auto size, Its... its)
+      {
+        return std::invoke(op, load_chunk<iter_simdize_t<Its, size>>(its)...);
+      }
+
+    template <typename It0, typename... Its>
+      constexpr auto
+      simdized_load_flag1_and_invoke(auto op, vir::constexpr_value auto size, auto flag0, It0 it0,
+                                     Its... its)
+      {
+        return std::invoke(op, load_chunk<iter_simdize_t<It0, size>>(it0, flag0),
+                           load_chunk<iter_simdize_t<Its, size>>(its)...);
+      }
+
+    template <typename R, typename... Ts>
+      VIR_ALWAYS_INLINE constexpr void
       simd_transform_prologue(auto&& op, auto dst_ptr, std::size_t to_process,
                               vir::constexpr_value auto max_elements, const Ts*... ptrs)
       {
@@ -687,7 +1502,7 @@ case0:
           {
             using R1 = vir::simdize<typename R0::value_type, 1>;
             const R1& result = simdized_load_and_invoke(binary_op, 1_cw, last - 1, ptrs...);
-            result.copy_to(std::to_address(d_first), f);
+            store_chunk(result, std::to_address(d_first), f);
             return;
           }
         using V = vir::simdize<T0, std::bit_ceil(size0) / 2>;
@@ -697,7 +1512,7 @@ case0:
             static_assert(std::has_single_bit(unsigned(V::size()))); // by construction
             const R& result = simdized_load_and_invoke(binary_op, vir::cw<V::size()>,
                                                        last - leftover, ptrs...);
-            result.copy_to(std::to_address(d_first), f);
+            store_chunk(result, std::to_address(d_first), f);
             leftover -= V::size();
             ((ptrs += V::size()), ...);
             d_first += V::size();
@@ -707,8 +1522,25 @@ case0:
             simd_transform_epilogue<V, R, More...>(binary_op, leftover, last, d_first, f, ptrs...);
       }
 
-    template<simd_execution_policy ExecutionPolicy, simd_execution_iterator It1,
-             simd_execution_iterator OutIt, typename Operation, simd_execution_iterator... It2>
+    /** \internal
+     * Epilogue replacement for masked_epilogue(): one masked load per input, one call of \p op,
+     * and one masked store of \p leftover elements to \p d_first.
+     */
+    template <typename V1, typename R, typename... It2>
+      VIR_ALWAYS_INLINE void
+      simd_transform_masked_epilogue(auto&& op, unsigned leftover, auto first1, auto d_first,
+                                     auto f, It2... first2)
+      {
+        const R& result
+          = std::invoke(op, masked_load<V1>(std::to_address(first1), leftover),
+                        masked_load<iter_simdize_t<It2, V1::size()>>(std::to_address(first2),
+                                                                     leftover)...);
+        masked_store(result, std::to_address(d_first), leftover, load_flags(f));
+      }
+
+    template<simd_execution_policy ExecutionPolicy, simd_execution_gatherable_iterator It1,
+             simd_execution_gatherable_iterator OutIt, typename Operation,
+             simd_execution_gatherable_iterator... It2>
       constexpr OutIt
       transform(ExecutionPolicy, It1 first1, It1 last1, OutIt d_first, Operation op, It2... first2)
       {
@@ -727,6 +1559,10 @@ case0:
         if (first1 == last1)
           return d_first;
 
+        if constexpr (simd_execution_segmented_iterator<It1>)
+          return segmented_transform<ExecutionPolicy>(iterator_segments(first1, last1), d_first,
+                                                      op, first2...);
+
         auto advance = [](int n, auto&... it) { ((it += n), ...); };
 
         std::size_t distance = std::distance(first1, last1);
@@ -736,7 +1572,39 @@ case0:
             distance % size == 0, "The explicit assumption, that the range size (%zu) is a multiple"
                                   " of the SIMD width (%d), does not hold.", distance, size());
 
-        if (std::is_constant_evaluated())
+        if constexpr (ExecutionPolicy::_parallel)
+          if (not std::is_constant_evaluated())
+            {
+              constexpr sequential_policy_t<ExecutionPolicy> seq;
+              constexpr std::size_t chunk = size * std::max(1, ExecutionPolicy::_unroll_by);
+              parallel_blocks(distance, parallel_block_size<OutT, chunk>, ExecutionPolicy::_threads,
+                              [&](std::size_t, std::size_t begin, std::size_t end) {
+                                vir::detail::transform(seq, first1 + begin, first1 + end,
+                                                       d_first + begin, op, first2 + begin...);
+                              });
+              return d_first + distance;
+            }
+
+        if constexpr (not (std::contiguous_iterator<It1> and std::contiguous_iterator<OutIt>
+                             and (std::contiguous_iterator<It2> and ...)))
+          {
+            // gather and scatter chunk-wise; the modifiers concerning alignment and memory access
+            // do not apply
+            std::size_t i = 0;
+            for (; i + size <= distance; i += size)
+              {
+                const OutV& result = simdized_load_and_invoke(op, size, first1 + i, first2 + i...);
+                store_chunk_at(result, d_first + i);
+              }
+            for (; i < distance; ++i)
+              {
+                const vir::simdize<OutT, 1>& result
+                  = simdized_load_and_invoke(op, 1_cw, first1 + i, first2 + i...);
+                store_chunk_at(result, d_first + i);
+              }
+            return d_first + distance;
+          }
+        else if (std::is_constant_evaluated())
           {
             // needs element_aligned because of GCC PR111302
             for (; first1 + (size - 1) < last1; advance(size, first1, d_first, first2...))
@@ -761,24 +1629,31 @@ case0:
             // Instead, let's simply focus on aligning the store address, avoiding pressure on the
             // store execution ports (a factor of 2 throughput difference with AVX-512 vectors).
             constexpr prologue<OutV, ExecutionPolicy> p;
-            constexpr auto flags = p.flags;
+            constexpr auto flags = p.store_flags;
             p(distance, d_first, [&] (auto max_elements, auto to_process) {
               simd_transform_prologue<vir::simdize<OutT, 1>, T1, std::iter_value_t<It2>...>(
                 op, std::to_address(d_first), to_process, max_elements, std::to_address(first1),
                 std::to_address(first2)...);
             }, first1, d_first, first2...);
 
+            auto prefetch = [&](vir::constexpr_value auto n) VIR_LAMBDA_ALWAYS_INLINE {
+              prefetch_ahead<ExecutionPolicy::_prefetch, n>(first1, first2...);
+              if constexpr (not p.use_stream_stores)
+                prefetch_ahead<ExecutionPolicy::_prefetch, n, 1>(d_first);
+            };
+
             if constexpr (ExecutionPolicy::_unroll_by > 1)
               {
                 constexpr auto step = size * ExecutionPolicy::_unroll_by;
                 const auto unrolled_last = last1 - step;
                 for (; first1 <= unrolled_last; advance(step, first1, d_first, first2...))
                   {
+                    prefetch(vir::cw<step>);
                     unroll2<ExecutionPolicy::_unroll_by>([&,size](auto i) {
                       return simdized_load_and_invoke(op, size, first1 + i * size,
                                                       first2 + i * size...);
                     }, [&,size](auto i, const OutV& result) {
-                      result.copy_to(std::to_address(d_first + i * size), flags);
+                      store_chunk(result, std::to_address(d_first + i * size), flags);
                     });
                   }
               }
@@ -787,8 +1662,9 @@ case0:
             for (; assume_matching_size ? first1 != last1 : first1 <= simd_last;
                  advance(size, first1, d_first, first2...))
               {
+                prefetch(size);
                 const OutV& result = simdized_load_and_invoke(op, size, first1, first2...);
-                result.copy_to(std::to_address(d_first), flags);
+                store_chunk(result, std::to_address(d_first), flags);
               }
 
             if constexpr (size > 1 and !assume_matching_size)
@@ -796,11 +1672,20 @@ case0:
                 const auto leftover = distance % size;
                 if (leftover)
                   {
-                    simd_transform_epilogue<V1, OutV, std::iter_value_t<It2>...>(
-                      op, leftover, last1, d_first, flags, std::to_address(first2)...);
+                    if constexpr (ExecutionPolicy::_masked_epilogue and stdx::is_simd_v<V1>
+                                    and stdx::is_simd_v<OutV>
+                                    and (stdx::is_simd_v<iter_simdize_t<It2, size>> and ...))
+                      simd_transform_masked_epilogue<V1, OutV>(op, leftover, first1, d_first,
+                                                               flags, first2...);
+                    else
+                      simd_transform_epilogue<V1, OutV, std::iter_value_t<It2>...>(
+                        op, leftover, last1, d_first, flags, std::to_address(first2)...);
                     d_first += leftover;
                   }
               }
+
+            if constexpr (p.use_stream_stores)
+              stream_fence();
           }
         return d_first;
       }
@@ -817,6 +1702,7 @@ case0:
         // - [first2, first2 + to_process) is a valid range
         static_assert(std::has_single_bit(unsigned(size)));
         static_assert(std::has_single_bit(unsigned(max_size)));
+        static_assert(size < max_size);
         if (to_process & size)
           {
             const std::size_t offset = to_process & (size - 1);
@@ -826,7 +1712,7 @@ case0:
                                 reduce_op);
             acc1 = std::invoke(reduce_op, acc1, x);
           }
-        if constexpr (size < max_size)
+        if constexpr (size * 2 < max_size)
           return simd_transform_reduce_prologue<size * 2, max_size>(
                    acc1, first1, to_process, reduce_op, transform_op, first2...);
         else
@@ -933,11 +1819,165 @@ case0:
           unreachable();
       }
 
+    /** \internal
+     * Running sum with compensation term (Neumaier's variant of Kahan summation). For simd types,
+     * the compensation is applied per element.
+     */
+    template <typename V>
+      struct neumaier_sum
+      {
+        V sum = 0;
+        V compensation = 0;
+
+        VIR_ALWAYS_INLINE void
+        add(const V& x)
+        {
+          const V t = sum + x;
+          V c = (x - t) + sum;
+          where(abs(sum) >= abs(x), c) = (sum - t) + x;
+          compensation += c;
+          sum = t;
+        }
+
+        VIR_ALWAYS_INLINE V
+        value() const
+        { return sum + compensation; }
+      };
+
+    /** \internal
+     * transform_reduce with std::plus as reduction, using one neumaier_sum per unrolled chunk. The
+     * elements after the last full chunk are added one by one.
+     */
+    template <int size, int unroll_by, typename T, typename It1, typename TransformOp,
+              typename... It2>
+      T
+      compensated_transform_reduce(It1 first1, It1 last1, T init, TransformOp transform_op,
+                                   It2... first2)
+      {
+        using A1 = vir::simdize<T, 1>;
+        using A = vir::simdize<T, size>;
+        std::array<neumaier_sum<A>, unroll_by> acc = {};
+        const std::size_t distance = std::distance(first1, last1);
+        std::size_t i = 0;
+        if constexpr (unroll_by > 1)
+          for (; i + size * unroll_by <= distance; i += size * unroll_by)
+            unroll<unroll_by>([&](auto j) {
+              const std::size_t offset = i + j * size;
+              acc[j].add(simdized_load_and_invoke(transform_op, vir::cw<size>, first1 + offset,
+                                                  first2 + offset...));
+            });
+        for (; i + size <= distance; i += size)
+          acc[0].add(simdized_load_and_invoke(transform_op, vir::cw<size>, first1 + i,
+                                              first2 + i...));
+        neumaier_sum<A1> total = {init, 0};
+        for (const neumaier_sum<A>& a : acc)
+          for (std::size_t lane = 0; lane < A::size(); ++lane)
+            {
+              total.add(A1(a.sum[lane]));
+              total.add(A1(a.compensation[lane]));
+            }
+        for (; i < distance; ++i)
+          total.add(simdized_load_and_invoke(transform_op, 1_cw, first1 + i, first2 + i...));
+        return total.value()[0];
+      }
+
+    /** \internal
+     * Width (in elements) of the accumulator in the canonical reduction order of reproducible().
+     */
+    template <typename T>
+      inline constexpr int reproducible_width = sizeof(T) >= 8 ? 16 : 32;
+
+    /** \internal
+     * Reduces the elements of \p v in a fixed tree: the upper half is combined into the lower
+     * half until a single element remains.
+     */
+    template <typename V, typename BinaryOp>
+      VIR_ALWAYS_INLINE auto
+      pairwise_reduce(const V& v, BinaryOp op)
+      {
+        static_assert((V::size() & (V::size() - 1)) == 0);
+        if constexpr (V::size() == 1)
+          return v;
+        else
+          {
+            constexpr std::size_t half = V::size() / 2;
+            const auto [lo, hi] = stdx::split<half, half>(v);
+            return pairwise_reduce(std::invoke(op, lo, hi), op);
+          }
+      }
+
+    /** \internal
+     * transform_reduce in the canonical order of reproducible(). The order depends only on \p T
+     * and the range size:
+     * - The elements up to the last multiple of W are split into blocks of
+     *   parallel_block_size<T, W>. Every block is reduced into a W-wide accumulator (element `i`
+     *   into lane `i % W`).
+     * - The block accumulators are reduced in block order.
+     * - The remaining elements are reduced into lanes 0, 1, ... of the result.
+     * - The lanes are reduced pairwise.
+     *
+     * Blocks are distributed over threads if ExecutionPolicy is parallel.
+     */
+    template <simd_execution_policy ExecutionPolicy, typename T, typename It1,
+              typename BinaryReductionOp, typename TransformOp, typename... It2>
+      T
+      reproducible_transform_reduce(It1 first1, It1 last1, T init, BinaryReductionOp reduce_op,
+                                    TransformOp transform_op, It2... first2)
+      {
+        constexpr int W = reproducible_width<T>;
+        constexpr std::size_t block_size = parallel_block_size<T, W>;
+        using A1 = vir::simdize<T, 1>;
+        using A = vir::simdize<T, W>;
+        const std::size_t distance = std::distance(first1, last1);
+        const std::size_t full = distance / W * W;
+        A1 acc1 = init;
+        if (full == 0)
+          {
+            for (std::size_t i = 0; i < distance; ++i)
+              acc1 = std::invoke(reduce_op, acc1, simdized_load_and_invoke(
+                                                    transform_op, 1_cw, first1 + i, first2 + i...));
+            return acc1[0];
+          }
+        auto reduce_block = [&](std::size_t begin, std::size_t end) {
+          A acc = simdized_load_and_invoke(transform_op, vir::cw<W>, first1 + begin,
+                                           first2 + begin...);
+          for (std::size_t i = begin + W; i < end; i += W)
+            acc = std::invoke(reduce_op, acc, simdized_load_and_invoke(
+                                                transform_op, vir::cw<W>, first1 + i, first2 + i...));
+          return acc;
+        };
+        A acc;
+        if constexpr (ExecutionPolicy::_parallel)
+          {
+            std::vector<A> partial((full + block_size - 1) / block_size);
+            parallel_blocks(full, block_size, ExecutionPolicy::_threads,
+                            [&](std::size_t b, std::size_t begin, std::size_t end) {
+                              partial[b] = reduce_block(begin, end);
+                            });
+            acc = partial[0];
+            for (std::size_t b = 1; b < partial.size(); ++b)
+              acc = std::invoke(reduce_op, acc, partial[b]);
+          }
+        else
+          {
+            acc = reduce_block(0, std::min(block_size, full));
+            for (std::size_t begin = block_size; begin < full; begin += block_size)
+              acc = std::invoke(reduce_op, acc,
+                                reduce_block(begin, std::min(begin + block_size, full)));
+          }
+        for (std::size_t i = full; i < distance; ++i)
+          acc[i - full] = std::invoke(reduce_op, A1(T(acc[i - full])),
+                                      simdized_load_and_invoke(transform_op, 1_cw, first1 + i,
+                                                               first2 + i...))[0];
+        return std::invoke(reduce_op, acc1, pairwise_reduce(acc, reduce_op))[0];
+      }
+
     /** \internal
      * Generic simd transform_reduce, that works for any number of input ranges.
      */
-    template <simd_execution_policy ExecutionPolicy, simd_execution_iterator It1, typename T,
-              typename BinaryReductionOp, typename TransformOp, simd_execution_iterator... It2>
+    template <simd_execution_policy ExecutionPolicy, simd_execution_gatherable_iterator It1,
+              typename T, typename BinaryReductionOp, typename TransformOp,
+              simd_execution_gatherable_iterator... It2>
       constexpr T
       transform_reduce(ExecutionPolicy, It1 first1, It1 last1, T init, BinaryReductionOp reduce_op,
                        TransformOp transform_op, It2... first2)
@@ -957,6 +1997,10 @@ case0:
         if (first1 == last1)
           return init;
 
+        if constexpr (simd_execution_segmented_iterator<It1>)
+          return segmented_transform_reduce<ExecutionPolicy>(
+                   iterator_segments(first1, last1), init, reduce_op, transform_op, first2...);
+
         A1 acc1 = init;
 
         std::size_t distance = std::distance(first1, last1);
@@ -966,7 +2010,84 @@ case0:
             distance % size == 0, "The explicit assumption, that the range size (%zu) is a multiple"
                                   " of the SIMD width (%d), does not hold.", distance, size);
 
-        if (std::is_constant_evaluated())
+        constexpr bool compensated
+          = ExecutionPolicy::_compensated and std::floating_point<T>
+              and (std::same_as<BinaryReductionOp, std::plus<>>
+                     or std::same_as<BinaryReductionOp, std::plus<T>>);
+
+        constexpr bool reproducible = ExecutionPolicy::_reproducible and std::is_arithmetic_v<T>;
+
+        if constexpr (ExecutionPolicy::_parallel and (compensated or not reproducible))
+          if (not std::is_constant_evaluated())
+            {
+              // Every block is reduced with its first element as initial value. The partial
+              // results are reduced in order, independent of the number of threads.
+              // (reproducible_transform_reduce distributes its blocks itself.)
+              constexpr sequential_policy_t<ExecutionPolicy> seq;
+              constexpr std::size_t chunk
+                = reproducible ? reproducible_width<T>
+                               : size * std::max(1, ExecutionPolicy::_unroll_by);
+              constexpr std::size_t block_size = parallel_block_size<T1, chunk>;
+              std::vector<A1> partial((distance + block_size - 1) / block_size);
+              parallel_blocks(distance, block_size, ExecutionPolicy::_threads,
+                              [&](std::size_t b, std::size_t begin, std::size_t end) {
+                                const T x0 = simdized_load_and_invoke(
+                                               transform_op, 1_cw, first1 + begin,
+                                               first2 + begin...)[0];
+                                partial[b] = vir::detail::transform_reduce(
+                                               seq, first1 + (begin + 1), first1 + end, x0,
+                                               reduce_op, transform_op, first2 + (begin + 1)...);
+                              });
+              if constexpr (compensated)
+                {
+                  neumaier_sum<A1> total = {acc1, 0};
+                  for (const A1& x : partial)
+                    total.add(x);
+                  return total.value()[0];
+                }
+              else
+                {
+                  for (const A1& x : partial)
+                    acc1 = std::invoke(reduce_op, acc1, x);
+                  return acc1[0];
+                }
+            }
+
+        if constexpr (compensated or reproducible)
+          if (not std::is_constant_evaluated())
+            {
+              if constexpr (compensated and reproducible)
+                return compensated_transform_reduce<reproducible_width<T>, 1>(
+                         first1, last1, init, transform_op, first2...);
+              else if constexpr (compensated)
+                return compensated_transform_reduce<size, std::max(1, ExecutionPolicy::_unroll_by)>(
+                         first1, last1, init, transform_op, first2...);
+              else
+                return reproducible_transform_reduce<ExecutionPolicy>(
+                         first1, last1, init, reduce_op, transform_op, first2...);
+            }
+
+        if constexpr (not (std::contiguous_iterator<It1>
+                             and (std::contiguous_iterator<It2> and ...)))
+          {
+            // gather chunk-wise; the modifiers concerning alignment and memory access do not apply
+            std::size_t i = 0;
+            if (distance >= std::size_t(size))
+              {
+                A acc = simdized_load_and_invoke(transform_op, vir::cw<size>, first1, first2...);
+                for (i = size; i + size <= distance; i += size)
+                  acc = std::invoke(reduce_op, acc,
+                                    simdized_load_and_invoke(transform_op, vir::cw<size>,
+                                                             first1 + i, first2 + i...));
+                acc1 = std::invoke(reduce_op, acc1, A1(reduce(acc, reduce_op)));
+              }
+            for (; i < distance; ++i)
+              acc1 = std::invoke(reduce_op, acc1,
+                                 simdized_load_and_invoke(transform_op, 1_cw, first1 + i,
+                                                          first2 + i...));
+            return acc1[0];
+          }
+        else if (std::is_constant_evaluated())
           {
             // needs element_aligned because of GCC PR111302
             for (; first1 < last1; ((first1 += 1), ..., (first2 += 1)))
@@ -986,6 +2107,9 @@ case0:
                          acc1, first1, to_process, reduce_op, transform_op, first2...);
               }, first1, first2...);
 
+            if (distance == 0)
+              return acc1[0];
+
             const auto leftover = distance % size;
 
             constexpr int lo_size = std::bit_ceil(unsigned(size)) / 2;
@@ -1002,7 +2126,7 @@ case0:
                       constexpr std::make_index_sequence<ExecutionPolicy::_unroll_by> unroll_idx_seq;
                       constexpr auto step = size * ExecutionPolicy::_unroll_by;
                       const auto unrolled_last = last1 - step;
-                      if (first1 + step <= unrolled_last)
+                      if (first1 <= unrolled_last)
                         {
                           auto acc = [&]<std::size_t... Is>(std::index_sequence<Is...>)
                                        -> std::array<A, ExecutionPolicy::_unroll_by>
@@ -1018,8 +2142,10 @@ case0:
                           }(unroll_idx_seq);
                           first1 += step;
                           ((first2 += step), ...);
-                          do
+                          // M independent dependency chains, combined only after the loop
+                          while (first1 <= unrolled_last)
                             {
+                              prefetch_ahead<ExecutionPolicy::_prefetch, step>(first1, first2...);
                               [&]<std::size_t... Is>(std::index_sequence<Is...>)
                                 VIR_LAMBDA_ALWAYS_INLINE {
                                   ([&](std::size_t i) VIR_LAMBDA_ALWAYS_INLINE {
@@ -1033,7 +2159,19 @@ case0:
                               first1 += step;
                               ((first2 += step), ...);
                             }
-                          while (first1 <= unrolled_last);
+                          // the remaining full chunks still go to separate accumulators
+                          unroll<ExecutionPolicy::_unroll_by - 1>([&](auto i) {
+                            if (assume_matching_size ? first1 != last1 : first1 <= simd_last)
+                              {
+                                acc[i] = std::invoke(
+                                           reduce_op, acc[i],
+                                           simdized_load_flag1_and_invoke(
+                                             transform_op, vir::cw<size>, flags,
+                                             first1, first2...));
+                                first1 += size;
+                                ((first2 += size), ...);
+                              }
+                          });
                             // tree reduction of acc into acc[0]
                             unroll<std::bit_width(unsigned(ExecutionPolicy::_unroll_by - 1))>(
                               [&](auto outer) {
@@ -1056,6 +2194,7 @@ case0:
                 for (; assume_matching_size ? first1 != last1 : first1 <= simd_last;
                      ((first1 += size), ..., (first2 += size)))
                   {
+                    prefetch_ahead<ExecutionPolicy::_prefetch, size>(first1, first2...);
                     acc = std::invoke(reduce_op, acc,
                                       simdized_load_flag1_and_invoke(transform_op, vir::cw<size>,
                                                                      flags, first1, first2...));
@@ -1064,6 +2203,19 @@ case0:
                   return std::invoke(reduce_op, acc1, acc)[0];
                 else if (assume_matching_size or leftover == 0)
                   return std::invoke(reduce_op, acc1, A1(reduce(acc, reduce_op)))[0];
+                else if constexpr (ExecutionPolicy::_masked_epilogue and stdx::is_simd_v<A>
+                                     and stdx::is_simd_v<V1>
+                                     and (stdx::is_simd_v<iter_simdize_t<It2, size>> and ...))
+                  {
+                    // only the first leftover elements of acc are updated
+                    where(first_n_mask<A>(leftover), acc) = std::invoke(
+                      reduce_op, acc,
+                      std::invoke(transform_op,
+                                  masked_load<V1>(std::to_address(first1), leftover, flags),
+                                  masked_load<iter_simdize_t<It2, size>>(
+                                    std::to_address(first2), leftover)...));
+                    return std::invoke(reduce_op, acc1, A1(reduce(acc, reduce_op)))[0];
+                  }
                 else
                   {
                     auto [lo, hi] = stdx::split<lo_size, hi_size>(acc);
@@ -1086,6 +2238,313 @@ case0:
               unreachable();
           }
       }
+
+    /** \internal
+     * Generic simd search, that works for any number of input ranges. Returns the offset of the
+     * first element where \p pred returns `true` or `distance(first1, last1)` if there is no such
+     * element. The search stops at the first chunk with a match.
+     */
+    template <simd_execution_policy ExecutionPolicy, simd_execution_iterator It1, typename F,
+              simd_execution_iterator... It2>
+      constexpr std::size_t
+      find_if(ExecutionPolicy, It1 first1, It1 last1, F&& pred, It2... first2)
+      {
+        using T1 = std::iter_value_t<It1>;
+        constexpr int size = [] {
+          if constexpr (ExecutionPolicy::_size > 0)
+            return ExecutionPolicy::_size;
+          else
+            return std::max({int(iter_simdize_t<It1, 0>::size()),
+                             int(iter_simdize_t<It2, 0>::size())...});
+        }();
+        using V1 = vir::simdize<T1, size>;
+
+        const std::size_t distance = std::distance(first1, last1);
+        if (distance == 0)
+          return 0;
+
+        constexpr bool assume_matching_size = ExecutionPolicy::_assume_matching_size;
+        if constexpr (assume_matching_size)
+          vir_simd_precondition_vaargs(
+            distance % size == 0, "The explicit assumption, that the range size (%zu) is a multiple"
+                                  " of the SIMD width (%d), does not hold.", distance, size);
+
+        std::size_t pos = 0;
+
+        // Prologue and epilogue call this function for consecutive chunks of the first range. It
+        // stops advancing pos on the first match.
+        bool found = false;
+        auto search_chunk = [&](const auto& x1) VIR_LAMBDA_ALWAYS_INLINE {
+          if (found)
+            return;
+          constexpr auto n = vir::cw<std::remove_cvref_t<decltype(x1)>::size()>;
+          const auto k = std::invoke(pred, x1, iter_simdize_t<It2, n>(
+                                                 std::to_address(first2 + pos),
+                                                 stdx::element_aligned)...);
+          if (any_of(k))
+            {
+              found = true;
+              pos += find_first_set(k);
+            }
+          else
+            pos += n;
+        };
+
+        if (std::is_constant_evaluated())
+          {
+            // needs element_aligned because of GCC PR111302
+            for (; pos + size <= distance; pos += size)
+              {
+                const auto k = std::invoke(
+                                 pred, V1(std::to_address(first1 + pos), stdx::element_aligned),
+                                 iter_simdize_t<It2, size>(std::to_address(first2 + pos),
+                                                           stdx::element_aligned)...);
+                if (any_of(k))
+                  return pos + find_first_set(k);
+              }
+            if constexpr (size > 1)
+              if (distance > pos)
+                simd_for_each_epilogue<V1, false>(search_chunk, distance - pos, last1,
+                                                  stdx::element_aligned);
+            return pos;
+          }
+
+        constexpr prologue<V1, ExecutionPolicy> p;
+        constexpr auto flags = p.flags;
+        std::size_t remaining = distance;
+        p(remaining, first1, [&](auto max_elements, auto to_process) VIR_LAMBDA_ALWAYS_INLINE {
+          simd_for_each_prologue<vir::simdize<T1, 1>, false, max_elements>(
+            search_chunk, std::to_address(first1), to_process);
+        });
+        if (found)
+          return pos;
+
+        auto load_and_test = [&](std::size_t i) VIR_LAMBDA_ALWAYS_INLINE {
+          return std::invoke(pred, V1(std::to_address(first1 + i), flags),
+                             iter_simdize_t<It2, size>(std::to_address(first2 + i),
+                                                       stdx::element_aligned)...);
+        };
+
+        if constexpr (ExecutionPolicy::_unroll_by > 1)
+          {
+            // test all chunks of one step, but branch only once per step
+            constexpr std::size_t step = size * ExecutionPolicy::_unroll_by;
+            for (; pos + step <= distance; pos += step)
+              {
+                const auto ks = [&]<std::size_t... Is>(std::index_sequence<Is...>)
+                                  VIR_LAMBDA_ALWAYS_INLINE {
+                                    return std::array{load_and_test(pos + Is * size)...};
+                                  }(std::make_index_sequence<ExecutionPolicy::_unroll_by>());
+                if (any_of(std::apply([](const auto&... k) { return (k or ...); }, ks)))
+                  {
+                    for (const auto& k : ks)
+                      {
+                        if (any_of(k))
+                          return pos + find_first_set(k);
+                        pos += size;
+                      }
+                    unreachable();
+                  }
+              }
+          }
+
+        for (; assume_matching_size ? pos != distance : pos + size <= distance; pos += size)
+          {
+            const auto k = load_and_test(pos);
+            if (any_of(k))
+              return pos + find_first_set(k);
+          }
+
+        if constexpr (not assume_matching_size and size > 1)
+          if (distance > pos)
+            simd_for_each_epilogue<V1, false>(search_chunk, distance - pos, last1, flags);
+        return pos;
+      }
+
+    /** \internal
+     * In-register inclusive scan of \p x over \p op in log2(size) shift-and-combine steps.
+     */
+    template <int Shift = 1, typename V, typename BinaryOp>
+      VIR_ALWAYS_INLINE constexpr V
+      simd_inclusive_prefix(V x, BinaryOp op)
+      {
+        using T = typename V::value_type;
+        if constexpr (Shift >= int(V::size()))
+          return x;
+        else
+          {
+            const V shifted = vir::simd_permute(x, vir::simd_permutations::shift<-Shift>);
+            if constexpr (std::same_as<BinaryOp, std::plus<>>
+                            or std::same_as<BinaryOp, std::plus<T>>)
+              // the zeros shifted in are the identity element
+              x = shifted + x;
+            else
+              where(not first_n_mask<V, Shift>(), x) = std::invoke(op, shifted, x);
+            return simd_inclusive_prefix<Shift * 2>(x, op);
+          }
+      }
+
+    /// Whether all indexes into a range of size \p n are representable as \p Index.
+    template <typename Index>
+      constexpr bool
+      all_indexes_representable(std::size_t n)
+      { return n == 0 or n - 1 <= std::size_t(std::numeric_limits<Index>::max()); }
+
+    template <typename Index, typename V>
+      using index_simd_t = vir::simdize<Index, std::remove_cvref_t<V>::size()>;
+
+    /** \internal
+     * Returns the indexes of the next chunk of type \p V, which starts at \p offset, and advances
+     * \p offset past the chunk.
+     */
+    template <typename Index, typename V>
+      VIR_ALWAYS_INLINE constexpr index_simd_t<Index, V>
+      next_chunk_index(std::size_t& offset)
+      {
+        using I = index_simd_t<Index, V>;
+        const I idx = vir::iota_v<I> + Index(offset);
+        offset += I::size();
+        return idx;
+      }
+
+    /** \internal
+     * Callable for for_each that invokes `fun(x, i)` for every chunk `x` it is called with. `i`
+     * holds the indexes of the elements of `x`. The algorithms visit the range in order, thus the
+     * index follows from the number of elements visited before.
+     */
+    template <typename Index, typename F>
+      struct for_each_indexed_fun
+      {
+        F* fun;
+        std::size_t* offset;
+
+        template <typename... Vs>
+          requires (std::invocable<F&, Vs, index_simd_t<Index, Vs>> and ...)
+          VIR_ALWAYS_INLINE constexpr void
+          operator()(Vs&&... chunks) const
+          {
+            (std::invoke(*fun, static_cast<Vs&&>(chunks), next_chunk_index<Index, Vs>(*offset)),
+             ...);
+          }
+      };
+
+    /** \internal
+     * Callable for transform that appends the indexes of the chunk to the arguments of \p fun.
+     */
+    template <typename Index, typename F>
+      struct transform_indexed_fun
+      {
+        F* fun;
+        std::size_t* offset;
+
+        template <typename V0, typename... Vs>
+          VIR_ALWAYS_INLINE constexpr auto
+          operator()(const V0& x0, const Vs&... xs) const
+          { return std::invoke(*fun, x0, xs..., next_chunk_index<Index, V0>(*offset)); }
+      };
+
+    /** \internal
+     * transform with transform_indexed_fun. Parallel blocks start with their own offset.
+     */
+    template <typename Index, simd_execution_policy ExecutionPolicy, simd_execution_iterator It1,
+              simd_execution_iterator OutIt, typename Operation, simd_execution_iterator... It2>
+      constexpr OutIt
+      transform_indexed(ExecutionPolicy, It1 first1, It1 last1, OutIt d_first, Operation op,
+                        It2... first2)
+      {
+        using T1 = std::iter_value_t<It1>;
+        using Fun = transform_indexed_fun<Index, Operation>;
+        constexpr sequential_policy_t<ExecutionPolicy> seq;
+        const std::size_t distance = std::distance(first1, last1);
+        vir_simd_precondition(all_indexes_representable<Index>(distance),
+                              "The range is too large for the requested Index type.");
+
+        if constexpr (ExecutionPolicy::_parallel)
+          if (not std::is_constant_evaluated())
+            {
+              constexpr std::size_t chunk = vir::simdize<T1, ExecutionPolicy::_size>::size()
+                                              * std::max(1, ExecutionPolicy::_unroll_by);
+              parallel_blocks(distance, parallel_block_size<T1, chunk>, ExecutionPolicy::_threads,
+                              [&](std::size_t, std::size_t begin, std::size_t end) {
+                                std::size_t offset = begin;
+                                vir::detail::transform(seq, first1 + begin, first1 + end,
+                                                       d_first + begin, Fun{&op, &offset},
+                                                       first2 + begin...);
+                              });
+              return d_first + distance;
+            }
+
+        std::size_t offset = 0;
+        return vir::detail::transform(seq, first1, last1, d_first, Fun{&op, &offset}, first2...);
+      }
+
+    /** \internal
+     * transform of the contiguous segments \p segs of the first input range. The output range and
+     * the other input ranges are not segmented.
+     */
+    template <simd_execution_policy ExecutionPolicy, typename Segs, typename OutIt,
+              typename Operation, typename... It2>
+      constexpr OutIt
+      segmented_transform(Segs&& segs, OutIt d_first, Operation op, It2... first2)
+      {
+        constexpr sequential_policy_t<ExecutionPolicy> seq;
+        std::size_t distance = 0;
+        for (auto&& seg : segs)
+          distance += std::ranges::size(seg);
+        segment_runs<ExecutionPolicy>(
+          segs, [&](std::size_t, auto seg, auto seg_last, std::size_t offset) {
+            for (; seg != seg_last; ++seg)
+              {
+                vir::detail::transform(seq, std::ranges::begin(*seg), std::ranges::end(*seg),
+                                       d_first + offset, op, first2 + offset...);
+                offset += std::ranges::size(*seg);
+              }
+          });
+        return d_first + distance;
+      }
+
+    /** \internal
+     * transform_reduce of the contiguous segments \p segs of the first input range. The
+     * accumulator is carried from one segment to the next. Parallel runs of segments start from
+     * their first element and the partial results are reduced in order.
+     */
+    template <simd_execution_policy ExecutionPolicy, typename Segs, typename T,
+              typename BinaryReductionOp, typename TransformOp, typename... It2>
+      constexpr T
+      segmented_transform_reduce(Segs&& segs, T init, BinaryReductionOp reduce_op,
+                                 TransformOp transform_op, It2... first2)
+      {
+        constexpr sequential_policy_t<ExecutionPolicy> seq;
+        using A1 = vir::simdize<T, 1>;
+        const std::optional<T> result = segment_runs<ExecutionPolicy>(
+          segs, [&](std::size_t run, auto seg, auto seg_last, std::size_t offset) {
+            std::optional<T> acc;
+            if (run == 0)
+              acc = init;
+            for (; seg != seg_last; ++seg)
+              {
+                const auto first1 = std::ranges::begin(*seg);
+                const std::size_t n = std::ranges::size(*seg);
+                std::size_t i = 0;
+                if (not acc and n > 0)
+                  {
+                    acc = simdized_load_and_invoke(transform_op, 1_cw, first1,
+                                                   first2 + offset...)[0];
+                    i = 1;
+                  }
+                if (i < n)
+                  acc = vir::detail::transform_reduce(seq, first1 + i, first1 + n, *acc, reduce_op,
+                                                      transform_op, first2 + (offset + i)...);
+                offset += n;
+              }
+            return acc;
+          }, [&](std::optional<T> a, std::optional<T> b) -> std::optional<T> {
+            if (not b)
+              return a;
+            return std::invoke(reduce_op, A1(*a), A1(*b))[0];
+          });
+        return *result;
+      }
   } // namespace detail
 
   /**
@@ -1107,8 +2566,8 @@ case0:
    * @{
    */
   /// Iterate over the given range (iterator overload).
-  template <detail::simd_execution_policy ExecutionPolicy, detail::simd_execution_iterator It,
-            typename F>
+  template <detail::simd_execution_policy ExecutionPolicy,
+            detail::simd_execution_gatherable_iterator It, typename F>
     constexpr void
     for_each([[maybe_unused]] ExecutionPolicy pol, It first, It last, F&& fun)
     {
@@ -1120,6 +2579,10 @@ case0:
       if (first == last)
         return;
 
+      if constexpr (detail::simd_execution_segmented_iterator<It>)
+        return detail::segmented_for_each<ExecutionPolicy>(detail::iterator_segments(first, last),
+                                                           fun);
+
       std::size_t distance = std::distance(first, last);
         constexpr bool assume_matching_size = ExecutionPolicy::_assume_matching_size;
         if constexpr (assume_matching_size)
@@ -1127,7 +2590,36 @@ case0:
             distance % size == 0, "The explicit assumption, that the range size (%zu) is a multiple"
                                   " of the SIMD width (%d), does not hold.", distance, size);
 
-      if (std::is_constant_evaluated())
+      if constexpr (ExecutionPolicy::_parallel)
+        if (not std::is_constant_evaluated())
+          {
+            constexpr detail::sequential_policy_t<ExecutionPolicy> seq;
+            constexpr std::size_t chunk = size * std::max(1, ExecutionPolicy::_unroll_by);
+            detail::parallel_blocks(distance, detail::parallel_block_size<T, chunk>,
+                                    ExecutionPolicy::_threads,
+                                    [&](std::size_t, std::size_t begin, std::size_t end) {
+                                      vir::for_each(seq, first + begin, first + end, fun);
+                                    });
+            return;
+          }
+
+      if constexpr (not std::contiguous_iterator<It>)
+        {
+          // gather and scatter chunk-wise; the modifiers concerning alignment and memory access
+          // do not apply
+          auto invoke_chunk = [&]<typename W>(std::size_t i) VIR_LAMBDA_ALWAYS_INLINE {
+            std::conditional_t<write_back, W, const W> x = detail::load_chunk<W>(first + i);
+            std::invoke(fun, x);
+            if constexpr (write_back)
+              detail::store_chunk_at(x, first + i);
+          };
+          std::size_t i = 0;
+          for (; i + size <= distance; i += size)
+            invoke_chunk.template operator()<V>(i);
+          for (; i < distance; ++i)
+            invoke_chunk.template operator()<vir::simdize<T, 1>>(i);
+        }
+      else if (std::is_constant_evaluated())
         {
           // needs element_aligned because of GCC PR111302
           for (; first + (size - 1) < last; first += size)
@@ -1141,7 +2633,7 @@ case0:
       else
         {
           constexpr detail::prologue<V, ExecutionPolicy> prologue;
-          constexpr auto flags = prologue.flags;
+          constexpr auto flags = prologue.store_flags;
           prologue(distance, first, [&] (auto max_elements, auto to_process) {
             detail::simd_for_each_prologue<vir::simdize<T, 1>, write_back, max_elements>(
               fun, std::to_address(first), to_process);
@@ -1154,6 +2646,7 @@ case0:
               const auto unrolled_last = last - step;
               for (; first <= unrolled_last; first += step)
                 {
+                  detail::prefetch_ahead<ExecutionPolicy::_prefetch, step, write_back>(first);
                   detail::simd_load_and_invoke<V, write_back>(
                     fun, std::to_address(first), flags,
                     std::make_index_sequence<ExecutionPolicy::_unroll_by>());
@@ -1162,21 +2655,119 @@ case0:
 
           const auto simd_last = last - size;
           for (; assume_matching_size ? first != last : first <= simd_last; first += size)
-            detail::simd_load_and_invoke<V, write_back>(fun, std::to_address(first), flags,
-                                                        detail::no_unroll);
+            {
+              detail::prefetch_ahead<ExecutionPolicy::_prefetch, size, write_back>(first);
+              detail::simd_load_and_invoke<V, write_back>(fun, std::to_address(first), flags,
+                                                          detail::no_unroll);
+            }
 
           if constexpr (not assume_matching_size and size > 1)
             if (leftover)
-              detail::simd_for_each_epilogue<V, write_back>(fun, leftover, last, flags);
+              {
+                if constexpr (ExecutionPolicy::_masked_epilogue and stdx::is_simd_v<V>)
+                  detail::simd_for_each_masked_epilogue<V, write_back>(fun, leftover, last, flags);
+                else
+                  detail::simd_for_each_epilogue<V, write_back>(fun, leftover, last, flags);
+              }
+
+          if constexpr (write_back and prologue.use_stream_stores)
+            detail::stream_fence();
         }
     }
 
   /// Iterate over the given range (range overload).
-  template <detail::simd_execution_policy ExecutionPolicy, detail::simd_execution_range R,
+  template <detail::simd_execution_policy ExecutionPolicy, detail::simd_execution_input_range R,
             typename F>
     constexpr void
     for_each(ExecutionPolicy pol, R&& rng, F&& fun)
-    { vir::for_each(pol, std::ranges::begin(rng), std::ranges::end(rng), std::forward<F>(fun)); }
+    {
+      if constexpr (detail::simd_execution_segmented_range<R>)
+        detail::segmented_for_each<ExecutionPolicy>(vir::segments(rng), fun);
+      else
+        vir::for_each(pol, std::ranges::begin(rng), std::ranges::end(rng), std::forward<F>(fun));
+    }
+
+  namespace detail
+  {
+    /// \internal for_each of the contiguous segments \p segs.
+    template <simd_execution_policy ExecutionPolicy, typename Segs, typename F>
+      constexpr void
+      segmented_for_each(Segs&& segs, F& fun)
+      {
+        constexpr sequential_policy_t<ExecutionPolicy> seq;
+        segment_runs<ExecutionPolicy>(segs, [&](std::size_t, auto seg, auto seg_last, std::size_t) {
+          for (; seg != seg_last; ++seg)
+            vir::for_each(seq, std::ranges::begin(*seg), std::ranges::end(*seg), fun);
+        });
+      }
+  } // namespace detail
+
+  /**@}*/
+
+  /**
+   * \defgroup vir_for_each_indexed Algorithm: for-each with index
+   *
+   * \brief Iterate over the given range, passing the indexes of the elements to the callable.
+   *
+   * Like vir::for_each, except that `fun` is called as `fun(x, i)`, where `i` is a
+   * `simd<Index>` of the same size as `x`, holding the positions of the elements of `x` in the
+   * range (`vir::iota_v` plus the offset of the chunk). With `unroll_by<M>()`, `fun` is called
+   * `M` times in a row, once for each chunk.
+   *
+   * \tparam Index The value-type of the index `simd`. The range size must be representable in
+   *               \p Index.
+   *
+   * \param pol   Needs to be vir::execution::simd or one of the derived types returned from its
+   *              modifiers. (\ref vir::detail::simd_execution_policy)
+   * \param first, last Iterator pair modelling vir::detail::simd_execution_iterator.
+   * \param rng   Input ranges modelling vir::detail::simd_execution_range.
+   * \param fun   Callable to be invoked per chunk of input elements and its indexes. If the first
+   *              function parameter of `fun` is declared as an lvalue reference, the
+   *              implementation assumes it needs to write back the argument after `fun` returns.
+   *
+   * @{
+   */
+  /// Iterate over the given range with index (iterator overload).
+  template <std::integral Index = int, detail::simd_execution_policy ExecutionPolicy,
+            detail::simd_execution_iterator It, typename F>
+    constexpr void
+    for_each_indexed([[maybe_unused]] ExecutionPolicy pol, It first, It last, F&& fun)
+    {
+      using T = std::iter_value_t<It>;
+      using Fun = detail::for_each_indexed_fun<Index, std::remove_reference_t<F>>;
+      constexpr detail::sequential_policy_t<ExecutionPolicy> seq;
+      const std::size_t distance = std::distance(first, last);
+      vir_simd_precondition(detail::all_indexes_representable<Index>(distance),
+                            "The range is too large for the requested Index type.");
+
+      if constexpr (ExecutionPolicy::_parallel)
+        if (not std::is_constant_evaluated())
+          {
+            constexpr std::size_t chunk = vir::simdize<T, ExecutionPolicy::_size>::size()
+                                            * std::max(1, ExecutionPolicy::_unroll_by);
+            detail::parallel_blocks(distance, detail::parallel_block_size<T, chunk>,
+                                    ExecutionPolicy::_threads,
+                                    [&](std::size_t, std::size_t begin, std::size_t end) {
+                                      std::size_t offset = begin;
+                                      vir::for_each(seq, first + begin, first + end,
+                                                    Fun{&fun, &offset});
+                                    });
+            return;
+          }
+
+      std::size_t offset = 0;
+      vir::for_each(seq, first, last, Fun{&fun, &offset});
+    }
+
+  /// Iterate over the given range with index (range overload).
+  template <std::integral Index = int, detail::simd_execution_policy ExecutionPolicy,
+            detail::simd_execution_range R, typename F>
+    constexpr void
+    for_each_indexed(ExecutionPolicy pol, R&& rng, F&& fun)
+    {
+      vir::for_each_indexed<Index>(pol, std::ranges::begin(rng), std::ranges::end(rng),
+                                   std::forward<F>(fun));
+    }
 
   /**@}*/
 
@@ -1210,40 +2801,50 @@ case0:
    * @{
    */
   /// Unary transform (iterator overload)
-  template<detail::simd_execution_policy ExecutionPolicy, detail::simd_execution_iterator It1,
-           detail::simd_execution_iterator OutIt, typename UnaryOperation>
+  template<detail::simd_execution_policy ExecutionPolicy,
+           detail::simd_execution_gatherable_iterator It1,
+           detail::simd_execution_gatherable_iterator OutIt, typename UnaryOperation>
     constexpr OutIt
     transform(ExecutionPolicy pol, It1 first1, It1 last1, OutIt d_first, UnaryOperation unary_op)
     { return detail::transform(pol, first1, last1, d_first, unary_op); }
 
   /// Binary transform (iterator overload)
-  template<detail::simd_execution_policy ExecutionPolicy, detail::simd_execution_iterator It1,
-           detail::simd_execution_iterator It2, detail::simd_execution_iterator OutIt,
-           typename BinaryOperation>
+  template<detail::simd_execution_policy ExecutionPolicy,
+           detail::simd_execution_gatherable_iterator It1,
+           detail::simd_execution_gatherable_iterator It2,
+           detail::simd_execution_gatherable_iterator OutIt, typename BinaryOperation>
     constexpr OutIt
     transform(ExecutionPolicy pol, It1 first1, It1 last1, It2 first2, OutIt d_first,
               BinaryOperation binary_op)
     { return detail::transform(pol, first1, last1, d_first, binary_op, first2); }
 
   /// Unary transform (range overload)
-  template <detail::simd_execution_policy ExecutionPolicy, detail::simd_execution_range R1,
-            detail::simd_execution_range R2, typename UnaryOperation>
+  template <detail::simd_execution_policy ExecutionPolicy, detail::simd_execution_input_range R1,
+            detail::simd_execution_gatherable_range R2, typename UnaryOperation>
     constexpr auto
     transform(ExecutionPolicy pol, R1&& r1, R2& d_rng, UnaryOperation unary_op)
     {
-      return detail::transform(pol, std::ranges::begin(r1), std::ranges::end(r1),
-                               std::ranges::begin(d_rng), unary_op);
+      if constexpr (detail::simd_execution_segmented_range<R1>)
+        return detail::segmented_transform<ExecutionPolicy>(vir::segments(r1),
+                                                            std::ranges::begin(d_rng), unary_op);
+      else
+        return detail::transform(pol, std::ranges::begin(r1), std::ranges::end(r1),
+                                 std::ranges::begin(d_rng), unary_op);
     }
 
   /// Binary transform (range overload)
-  template <detail::simd_execution_policy ExecutionPolicy, detail::simd_execution_range R1,
-            detail::simd_execution_range R2, detail::simd_execution_range R3,
-            typename BinaryOperation>
+  template <detail::simd_execution_policy ExecutionPolicy, detail::simd_execution_input_range R1,
+            detail::simd_execution_gatherable_range R2,
+            detail::simd_execution_gatherable_range R3, typename BinaryOperation>
     constexpr auto
     transform(ExecutionPolicy pol, R1&& r1, R2&& r2, R3& d_rng, BinaryOperation binary_op)
     {
-      return detail::transform(pol, std::ranges::begin(r1), std::ranges::end(r1),
-                               std::ranges::begin(d_rng), binary_op, std::ranges::begin(r2));
+      if constexpr (detail::simd_execution_segmented_range<R1>)
+        return detail::segmented_transform<ExecutionPolicy>(
+                 vir::segments(r1), std::ranges::begin(d_rng), binary_op, std::ranges::begin(r2));
+      else
+        return detail::transform(pol, std::ranges::begin(r1), std::ranges::end(r1),
+                                 std::ranges::begin(d_rng), binary_op, std::ranges::begin(r2));
     }
 
 #if __cpp_lib_ranges_zip >= 202110L
@@ -1272,6 +2873,74 @@ case0:
 
   /**@}*/
 
+  /**
+   * \defgroup vir_transform_indexed Algorithm: transform with index
+   *
+   * \brief Like vir::transform, passing the indexes of the elements to the callable.
+   *
+   * \p op is called as `op(x1, i)` / `op(x1, x2, i)`, where `i` is a `simd<Index>` of the same
+   * size as `x1`, holding the positions of the elements of `x1` in the input range
+   * (`vir::iota_v` plus the offset of the chunk).
+   *
+   * \tparam Index The value-type of the index `simd`. The range size must be representable in
+   *               \p Index.
+   *
+   * \return Output iterator to the element that follows the last element transformed.
+   *
+   * \param pol     Needs to be vir::execution::simd or one of the derived types returned from its
+   *                modifiers. (\ref vir::detail::simd_execution_policy)
+   * \param first1, last1 Iterator pair modelling vir::detail::simd_execution_iterator.
+   * \param first2  Begin iterator modelling vir::detail::simd_execution_iterator.
+   *                std::distance `(first1, last1)` determines the size of this range.
+   * \param r1, r2  Input ranges modelling vir::detail::simd_execution_range.
+   * \param d_first   Output iterator modelling vir::detail::simd_execution_iterator.
+   * \param d_rng     Output range modelling vir::detail::simd_execution_range.
+   * \param op      Callable to be invoked per chunk of input elements and its indexes.
+   *
+   * @{
+   */
+  /// Unary transform with index (iterator overload)
+  template <std::integral Index = int, detail::simd_execution_policy ExecutionPolicy,
+            detail::simd_execution_iterator It1, detail::simd_execution_iterator OutIt,
+            typename UnaryOperation>
+    constexpr OutIt
+    transform_indexed(ExecutionPolicy pol, It1 first1, It1 last1, OutIt d_first,
+                      UnaryOperation op)
+    { return detail::transform_indexed<Index>(pol, first1, last1, d_first, op); }
+
+  /// Binary transform with index (iterator overload)
+  template <std::integral Index = int, detail::simd_execution_policy ExecutionPolicy,
+            detail::simd_execution_iterator It1, detail::simd_execution_iterator It2,
+            detail::simd_execution_iterator OutIt, typename BinaryOperation>
+    constexpr OutIt
+    transform_indexed(ExecutionPolicy pol, It1 first1, It1 last1, It2 first2, OutIt d_first,
+                      BinaryOperation op)
+    { return detail::transform_indexed<Index>(pol, first1, last1, d_first, op, first2); }
+
+  /// Unary transform with index (range overload)
+  template <std::integral Index = int, detail::simd_execution_policy ExecutionPolicy,
+            detail::simd_execution_range R1, detail::simd_execution_range R2,
+            typename UnaryOperation>
+    constexpr auto
+    transform_indexed(ExecutionPolicy pol, R1&& r1, R2& d_rng, UnaryOperation op)
+    {
+      return vir::transform_indexed<Index>(pol, std::ranges::begin(r1), std::ranges::end(r1),
+                                           std::ranges::begin(d_rng), op);
+    }
+
+  /// Binary transform with index (range overload)
+  template <std::integral Index = int, detail::simd_execution_policy ExecutionPolicy,
+            detail::simd_execution_range R1, detail::simd_execution_range R2,
+            detail::simd_execution_range R3, typename BinaryOperation>
+    constexpr auto
+    transform_indexed(ExecutionPolicy pol, R1&& r1, R2&& r2, R3& d_rng, BinaryOperation op)
+    {
+      return vir::transform_indexed<Index>(pol, std::ranges::begin(r1), std::ranges::end(r1),
+                                           std::ranges::begin(r2), std::ranges::begin(d_rng), op);
+    }
+
+  /**@}*/
+
   /**
    * \defgroup vir_transform_reduce Algorithm: transform_reduce
    *
@@ -1332,8 +3001,9 @@ case0:
    * @{
    */
   /// Inner product (iterator overload)
-  template <detail::simd_execution_policy ExecutionPolicy, detail::simd_execution_iterator It1,
-            detail::simd_execution_iterator It2, typename T>
+  template <detail::simd_execution_policy ExecutionPolicy,
+            detail::simd_execution_gatherable_iterator It1,
+            detail::simd_execution_gatherable_iterator It2, typename T>
     constexpr T
     transform_reduce(ExecutionPolicy policy, It1 first1, It1 last1, It2 first2, T init)
     {
@@ -1342,8 +3012,9 @@ case0:
     }
 
   /// As above but with user-provided transform and reduce operations (iterator overload)
-  template <detail::simd_execution_policy ExecutionPolicy, detail::simd_execution_iterator It1,
-            detail::simd_execution_iterator It2, typename T, typename BinaryReductionOp,
+  template <detail::simd_execution_policy ExecutionPolicy,
+            detail::simd_execution_gatherable_iterator It1,
+            detail::simd_execution_gatherable_iterator It2, typename T, typename BinaryReductionOp,
             typename BinaryTransformOp>
     constexpr T
     transform_reduce(ExecutionPolicy policy, It1 first1, It1 last1, It2 first2, T init,
@@ -1353,44 +3024,62 @@ case0:
     }
 
   /// Transform one input range with subsequent reduction (iterator overload)
-  template <detail::simd_execution_policy ExecutionPolicy, detail::simd_execution_iterator It,
-            typename T, typename BinaryReductionOp, typename UnaryTransformOp>
+  template <detail::simd_execution_policy ExecutionPolicy,
+            detail::simd_execution_gatherable_iterator It, typename T, typename BinaryReductionOp,
+            typename UnaryTransformOp>
     constexpr T
     transform_reduce(ExecutionPolicy policy, It first1, It last1, T init,
                      BinaryReductionOp reduce_op, UnaryTransformOp transform_op)
     { return detail::transform_reduce(policy, first1, last1, init, reduce_op, transform_op); }
 
   /// Inner product (range overload)
-  template <detail::simd_execution_policy ExecutionPolicy, detail::simd_execution_range Rng1,
-            detail::simd_execution_range Rng2, typename T>
+  template <detail::simd_execution_policy ExecutionPolicy,
+            detail::simd_execution_input_range Rng1,
+            detail::simd_execution_gatherable_range Rng2, typename T>
     constexpr T
     transform_reduce(ExecutionPolicy policy, Rng1&& r1, Rng2&& r2, T init)
     {
-      return detail::transform_reduce(policy, std::ranges::begin(r1), std::ranges::end(r1), init,
-                                      std::plus<>(), std::multiplies<>(), std::ranges::begin(r2));
+      if constexpr (detail::simd_execution_segmented_range<Rng1>)
+        return detail::segmented_transform_reduce<ExecutionPolicy>(
+                 vir::segments(r1), init, std::plus<>(), std::multiplies<>(),
+                 std::ranges::begin(r2));
+      else
+        return detail::transform_reduce(policy, std::ranges::begin(r1), std::ranges::end(r1),
+                                        init, std::plus<>(), std::multiplies<>(),
+                                        std::ranges::begin(r2));
     }
 
   /// As above but with user-provided transform and reduce operations (range overload)
-  template <detail::simd_execution_policy ExecutionPolicy, detail::simd_execution_range Rng1,
-            detail::simd_execution_range Rng2, typename T, typename BinaryReductionOp,
+  template <detail::simd_execution_policy ExecutionPolicy,
+            detail::simd_execution_input_range Rng1,
+            detail::simd_execution_gatherable_range Rng2, typename T, typename BinaryReductionOp,
             typename BinaryTransformOp>
     constexpr T
     transform_reduce(ExecutionPolicy policy, Rng1&& r1, Rng2&& r2, T init,
                  BinaryReductionOp reduce_op, BinaryTransformOp transform_op)
     {
-      return detail::transform_reduce(policy, std::ranges::begin(r1), std::ranges::end(r1), init,
-                                      reduce_op, transform_op, std::ranges::begin(r2));
+      if constexpr (detail::simd_execution_segmented_range<Rng1>)
+        return detail::segmented_transform_reduce<ExecutionPolicy>(
+                 vir::segments(r1), init, reduce_op, transform_op, std::ranges::begin(r2));
+      else
+        return detail::transform_reduce(policy, std::ranges::begin(r1), std::ranges::end(r1),
+                                        init, reduce_op, transform_op, std::ranges::begin(r2));
     }
 
   /// Transform one input range with subsequent reduction (range overload)
-  template <detail::simd_execution_policy ExecutionPolicy, detail::simd_execution_range Rng,
-            typename T, typename BinaryReductionOp, typename UnaryTransformOp>
+  template <detail::simd_execution_policy ExecutionPolicy,
+            detail::simd_execution_input_range Rng, typename T, typename BinaryReductionOp,
+            typename UnaryTransformOp>
     constexpr T
     transform_reduce(ExecutionPolicy policy, Rng&& r1, T init, BinaryReductionOp reduce_op,
                      UnaryTransformOp transform_op)
     {
-      return detail::transform_reduce(policy, std::ranges::begin(r1), std::ranges::end(r1), init,
-                                      reduce_op, transform_op);
+      if constexpr (detail::simd_execution_segmented_range<Rng>)
+        return detail::segmented_transform_reduce<ExecutionPolicy>(vir::segments(r1), init,
+                                                                   reduce_op, transform_op);
+      else
+        return detail::transform_reduce(policy, std::ranges::begin(r1), std::ranges::end(r1),
+                                        init, reduce_op, transform_op);
     }
 
   /**@}*/
@@ -1402,8 +3091,8 @@ case0:
    *
    * \param policy  Needs to be vir::execution::simd or one of the derived types returned from its
    *                modifiers. (\ref vir::detail::simd_execution_policy)
-   * \param first, last  Iterator pair modelling vir::detail::simd_execution_iterator.
-   * \param rg      Input ranges modelling vir::detail::simd_execution_range.
+   * \param first, last  Iterator pair modelling vir::detail::simd_execution_gatherable_iterator.
+   * \param rg      Input ranges modelling vir::detail::simd_execution_gatherable_range.
    * \param op      Callable to be invoked with two `simd` objects of input elements or intermediate
    *                results.
    *
@@ -1413,7 +3102,8 @@ case0:
    * @{
    */
   /// Sum the given range (iterator overload)
-  template <detail::simd_execution_policy ExecutionPolicy, detail::simd_execution_iterator It>
+  template <detail::simd_execution_policy ExecutionPolicy,
+            detail::simd_execution_gatherable_iterator It>
     constexpr std::iter_value_t<It>
     reduce(ExecutionPolicy policy, It first, It last)
     {
@@ -1422,8 +3112,8 @@ case0:
     }
 
   /// Sum the given range with initial value \p init (iterator overload)
-  template <detail::simd_execution_policy ExecutionPolicy, detail::simd_execution_iterator It,
-            typename T>
+  template <detail::simd_execution_policy ExecutionPolicy,
+            detail::simd_execution_gatherable_iterator It, typename T>
     constexpr T
     reduce(ExecutionPolicy policy, It first, It last, T init)
     {
@@ -1432,8 +3122,8 @@ case0:
     }
 
   /// Reduce the given range with initial value \p init over \p op (iterator overload)
-  template <detail::simd_execution_policy ExecutionPolicy, detail::simd_execution_iterator It,
-            typename T, typename BinaryReductionOp>
+  template <detail::simd_execution_policy ExecutionPolicy,
+            detail::simd_execution_gatherable_iterator It, typename T, typename BinaryReductionOp>
     constexpr T
     reduce(ExecutionPolicy policy, It first, It last, T init, BinaryReductionOp op)
     {
@@ -1442,33 +3132,31 @@ case0:
     }
 
   /// Sum the given range (range overload)
-  template <detail::simd_execution_policy ExecutionPolicy, detail::simd_execution_range Rg>
+  template <detail::simd_execution_policy ExecutionPolicy, detail::simd_execution_input_range Rg>
     constexpr std::ranges::range_value_t<Rg>
     reduce(ExecutionPolicy policy, Rg&& rg)
     {
-      return detail::transform_reduce(policy, std::ranges::begin(rg), std::ranges::end(rg),
-                                      std::ranges::range_value_t<Rg>{}, std::plus<>(),
-                                      [](auto const& x) { return x; });
+      return vir::transform_reduce(policy, rg, std::ranges::range_value_t<Rg>{}, std::plus<>(),
+                                   [](auto const& x) { return x; });
     }
 
   /// Sum the given range with initial value \p init (range overload)
-  template <detail::simd_execution_policy ExecutionPolicy, detail::simd_execution_range Rg,
+  template <detail::simd_execution_policy ExecutionPolicy, detail::simd_execution_input_range Rg,
             typename T>
     constexpr T
     reduce(ExecutionPolicy policy, Rg&& rg, T init)
     {
-      return detail::transform_reduce(policy, std::ranges::begin(rg), std::ranges::end(rg), init,
-                                      std::plus<>(), [](auto const& x) { return x; });
+      return vir::transform_reduce(policy, rg, init, std::plus<>(),
+                                   [](auto const& x) { return x; });
     }
 
   /// Reduce the given range with initial value \p init over \p op (range overload)
-  template <detail::simd_execution_policy ExecutionPolicy, detail::simd_execution_range Rg,
+  template <detail::simd_execution_policy ExecutionPolicy, detail::simd_execution_input_range Rg,
             typename T, typename BinaryReductionOp>
     constexpr T
     reduce(ExecutionPolicy policy, Rg&& rg, T init, BinaryReductionOp op)
     {
-      return detail::transform_reduce(policy, std::ranges::begin(rg), std::ranges::end(rg), init,
-                                      op, [](auto const& x) { return x; });
+      return vir::transform_reduce(policy, rg, init, op, [](auto const& x) { return x; });
     }
 
   /**@}*/
@@ -1493,14 +3181,28 @@ case0:
   template <detail::simd_execution_policy ExecutionPolicy, detail::simd_execution_iterator It,
             typename F>
     constexpr int
-    count_if(ExecutionPolicy pol, It first, It last, F&& pred)
+    count_if([[maybe_unused]] ExecutionPolicy pol, It first, It last, F&& pred)
     {
       using T = std::iter_value_t<It>;
       using TV = vir::simdize<T, ExecutionPolicy::_size>;
       using IV = detail::deduced_simd<int, TV::size()>;
+      constexpr detail::sequential_policy_t<ExecutionPolicy> seq;
+      if constexpr (ExecutionPolicy::_parallel)
+        if (not std::is_constant_evaluated())
+          {
+            constexpr std::size_t chunk = TV::size() * std::max(1, ExecutionPolicy::_unroll_by);
+            std::atomic<int> count = 0;
+            detail::parallel_blocks(std::distance(first, last),
+                                    detail::parallel_block_size<T, chunk>,
+                                    ExecutionPolicy::_threads,
+                                    [&](std::size_t, std::size_t begin, std::size_t end) {
+                                      count += vir::count_if(seq, first + begin, first + end, pred);
+                                    });
+            return count;
+          }
       int count = 0;
       IV countv = 0;
-      vir::for_each(pol, first, last, [&](auto... x) VIR_LAMBDA_ALWAYS_INLINE {
+      vir::for_each(seq, first, last, [&](auto... x) VIR_LAMBDA_ALWAYS_INLINE {
 #if __cpp_lib_experimental_parallel_simd >= 201803
         if (std::is_constant_evaluated())
           count += (popcount(pred(x)) + ...);
@@ -1532,124 +3234,1195 @@ case0:
     }
 
   /**@}*/
-}  // namespace vir
-
-/// \internal
-namespace std
-{
-  /** \brief Overloads std::for_each for vir::execution::simd.
-   * \ingroup vir_for_each
-   */
-  template <vir::detail::simd_execution_policy ExecutionPolicy,
-            vir::detail::simd_execution_iterator It, typename F>
-    constexpr void
-    for_each(ExecutionPolicy pol, It first, It last, F&& fun)
-    { vir::for_each(pol, first, last, std::forward<F>(fun)); }
 
-  /** \brief Overloads std::transform for vir::execution::simd.
-   * \ingroup vir_transform
+  /**
+   * \defgroup vir_copy_if Algorithm: copy_if, remove_if, partition_copy
+   *
+   * \brief Copies (or removes) the elements of the input range that satisfy \p pred.
+   *
+   * These functions are drop-in replacements for std::copy_if, std::remove_if, and
+   * std::partition_copy. The only difference is that \p pred is called with multiple values out of
+   * the input range via `simd` arguments. The selected elements are written contiguously via
+   * vir::compress_store. The relative order of the elements is preserved.
+   *
+   * The value-type of the input range must be vectorizable (i.e. `simd<T>` is valid).
+   *
+   * \param pol     Needs to be vir::execution::simd or one of the derived types returned from its
+   *                modifiers. (\ref vir::detail::simd_execution_policy)
+   * \param first, last  Iterator pair modelling vir::detail::simd_execution_iterator.
+   * \param rg      Input range modelling vir::detail::simd_execution_range.
+   * \param d_first, d_first_true, d_first_false  Output iterators modelling
+   *                vir::detail::simd_execution_iterator. The output ranges must not overlap with
+   *                the input range.
+   * \param d_rng, d_rng_true, d_rng_false  Output ranges modelling
+   *                vir::detail::simd_execution_range.
+   * \param pred    Callable that is invoked with multiple input elements in a `simd` object,
+   *                returning a `simd_mask` indicating the elements to be copied (or removed).
+   *
+   * @{
    */
-  template<vir::detail::simd_execution_policy ExecutionPolicy,
-           vir::detail::simd_execution_iterator It1, vir::detail::simd_execution_iterator OutIt,
-           typename UnaryOperation>
+  /// Copy the elements matching \p pred to \p d_first (iterator overload)
+  template <detail::simd_execution_policy ExecutionPolicy, detail::simd_execution_iterator It,
+            detail::simd_execution_iterator OutIt, typename F>
+    requires vectorizable<std::iter_value_t<It>>
     constexpr OutIt
-    transform(ExecutionPolicy pol, It1 first1, It1 last1, OutIt d_first, UnaryOperation unary_op)
-    { return vir::detail::transform(pol, first1, last1, d_first, unary_op); }
+    copy_if([[maybe_unused]] ExecutionPolicy pol, It first, It last, OutIt d_first, F&& pred)
+    {
+      auto out = std::to_address(d_first);
+      vir::for_each(detail::sequential_policy_t<ExecutionPolicy>(), first, last,
+                    [&](const auto&... x) VIR_LAMBDA_ALWAYS_INLINE {
+        ((out += vir::compress_store(where(pred(x), x), out)), ...);
+      });
+      return d_first + (out - std::to_address(d_first));
+    }
 
-  /** \brief Overloads std::transform for vir::execution::simd.
-   * \ingroup vir_transform
+  /// Copy the elements matching \p pred to \p d_rng (range overload)
+  template <detail::simd_execution_policy ExecutionPolicy, detail::simd_execution_range R1,
+            detail::simd_execution_range R2, typename F>
+    requires vectorizable<std::ranges::range_value_t<R1>>
+    constexpr auto
+    copy_if(ExecutionPolicy pol, R1&& rg, R2& d_rng, F&& pred)
+    {
+      return vir::copy_if(pol, std::ranges::begin(rg), std::ranges::end(rg),
+                          std::ranges::begin(d_rng), std::forward<F>(pred));
+    }
+
+  /**
+   * Remove the elements matching \p pred, moving the remaining elements to the front of the range
+   * (iterator overload).
+   *
+   * \return Past-the-end iterator for the new end of the range.
    */
-  template<vir::detail::simd_execution_policy ExecutionPolicy,
-           vir::detail::simd_execution_iterator It1, vir::detail::simd_execution_iterator It2,
-           vir::detail::simd_execution_iterator OutIt, typename BinaryOperation>
-    constexpr OutIt
-    transform(ExecutionPolicy pol, It1 first1, It1 last1, It2 first2, OutIt d_first,
-              BinaryOperation binary_op)
-    { return vir::detail::transform(pol, first1, last1, d_first, binary_op, first2); }
+  template <detail::simd_execution_policy ExecutionPolicy, detail::simd_execution_iterator It,
+            typename F>
+    requires vectorizable<std::iter_value_t<It>>
+    constexpr It
+    remove_if([[maybe_unused]] ExecutionPolicy pol, It first, It last, F&& pred)
+    {
+      // Writing in-place is safe: the algorithm only stores to elements that were already loaded
+      // and all stores of a chunk are at or before the position of the chunk.
+      auto out = std::to_address(first);
+      vir::for_each(detail::sequential_policy_t<ExecutionPolicy>(), first, last,
+                    [&](const auto&... x) VIR_LAMBDA_ALWAYS_INLINE {
+        ((out += vir::compress_store(where(not pred(x), x), out)), ...);
+      });
+      return first + (out - std::to_address(first));
+    }
 
+  /// As above (range overload)
+  template <detail::simd_execution_policy ExecutionPolicy, detail::simd_execution_range R,
+            typename F>
+    requires vectorizable<std::ranges::range_value_t<R>>
+    constexpr auto
+    remove_if(ExecutionPolicy pol, R&& rg, F&& pred)
+    {
+      return vir::remove_if(pol, std::ranges::begin(rg), std::ranges::end(rg),
+                            std::forward<F>(pred));
+    }
 
-  /** \brief Overloads std::transform_reduce for vir::execution::simd.
-   * \ingroup vir_transform_reduce
+  /**
+   * Copy the elements matching \p pred to \p d_first_true and all other elements to
+   * \p d_first_false (iterator overload).
+   *
+   * \return A pair of the past-the-end iterators of the two output ranges.
    */
-  template <vir::detail::simd_execution_policy ExecutionPolicy,
-           vir::detail::simd_execution_iterator It1, vir::detail::simd_execution_iterator It2,
-           typename T>
-    constexpr T
-    transform_reduce(ExecutionPolicy policy, It1 first1, It1 last1, It2 first2, T init)
+  template <detail::simd_execution_policy ExecutionPolicy, detail::simd_execution_iterator It,
+            detail::simd_execution_iterator OutIt1, detail::simd_execution_iterator OutIt2,
+            typename F>
+    requires vectorizable<std::iter_value_t<It>>
+    constexpr std::pair<OutIt1, OutIt2>
+    partition_copy([[maybe_unused]] ExecutionPolicy pol, It first, It last,
+                   OutIt1 d_first_true, OutIt2 d_first_false, F&& pred)
     {
-      return vir::detail::transform_reduce(policy, first1, last1, init, std::plus<>(),
-                                           std::multiplies<>(), first2);
+      auto out_true = std::to_address(d_first_true);
+      auto out_false = std::to_address(d_first_false);
+      vir::for_each(detail::sequential_policy_t<ExecutionPolicy>(), first, last,
+                    [&](const auto&... x) VIR_LAMBDA_ALWAYS_INLINE {
+        ([&](const auto& k) VIR_LAMBDA_ALWAYS_INLINE {
+          out_true += vir::compress_store(where(k, x), out_true);
+          out_false += vir::compress_store(where(not k, x), out_false);
+        }(pred(x)), ...);
+      });
+      return {d_first_true + (out_true - std::to_address(d_first_true)),
+              d_first_false + (out_false - std::to_address(d_first_false))};
     }
 
-  /** \brief Overloads std::transform_reduce for vir::execution::simd.
-   * \ingroup vir_transform_reduce
-   */
-  template <vir::detail::simd_execution_policy ExecutionPolicy,
-            vir::detail::simd_execution_iterator It1, vir::detail::simd_execution_iterator It2,
-            typename T, typename BinaryReductionOp, typename BinaryTransformOp>
-    constexpr T
-    transform_reduce(ExecutionPolicy policy, It1 first1, It1 last1, It2 first2, T init,
-                 BinaryReductionOp reduce_op, BinaryTransformOp transform_op)
+  /// As above (range overload)
+  template <detail::simd_execution_policy ExecutionPolicy, detail::simd_execution_range R1,
+            detail::simd_execution_range R2, detail::simd_execution_range R3, typename F>
+    requires vectorizable<std::ranges::range_value_t<R1>>
+    constexpr auto
+    partition_copy(ExecutionPolicy pol, R1&& rg, R2& d_rng_true, R3& d_rng_false, F&& pred)
     {
-      return vir::detail::transform_reduce(policy, first1, last1, init, reduce_op, transform_op,
-                                           first2);
+      return vir::partition_copy(pol, std::ranges::begin(rg), std::ranges::end(rg),
+                                 std::ranges::begin(d_rng_true), std::ranges::begin(d_rng_false),
+                                 std::forward<F>(pred));
     }
 
-  /** \brief Overloads std::transform_reduce for vir::execution::simd.
-   * \ingroup vir_transform_reduce
-   */
-  template <vir::detail::simd_execution_policy ExecutionPolicy,
-            vir::detail::simd_execution_iterator It, typename T, typename BinaryReductionOp,
-            typename UnaryTransformOp>
-    constexpr T
-    transform_reduce(ExecutionPolicy policy, It first1, It last1, T init,
-                     BinaryReductionOp reduce_op, UnaryTransformOp transform_op)
-    { return vir::detail::transform_reduce(policy, first1, last1, init, reduce_op, transform_op); }
+  /**@}*/
 
-  /** \brief Overloads std::reduce for vir::execution::simd.
-   * \ingroup vir_reduce
+  /**
+   * \defgroup vir_find_if Algorithm: find_if, any_of, all_of, none_of, mismatch, equal
+   *
+   * \brief Searches the input range(s) for the first element satisfying a condition.
+   *
+   * These functions are drop-in replacements for the corresponding std algorithms. The only
+   * difference is that \p pred is called with multiple values out of the input range(s) via `simd`
+   * arguments and must return a `simd_mask`. The search stops at the first chunk where any of the
+   * `simd_mask` elements is `true`. Consequently, \p pred may be invoked for elements after the
+   * first match (but never beyond the end of the range).
+   *
+   * \param pol     Needs to be vir::execution::simd or one of the derived types returned from its
+   *                modifiers. (\ref vir::detail::simd_execution_policy)
+   * \param first, last, first1, last1, first2, last2  Iterator pairs modelling
+   *                vir::detail::simd_execution_iterator.
+   * \param rg, rg1, rg2  Input ranges modelling vir::detail::simd_execution_range.
+   * \param pred    Callable that is invoked with multiple input elements in one `simd` object (or
+   *                two `simd` objects for mismatch and equal), returning a `simd_mask`.
+   *
+   * @{
    */
-  template <vir::detail::simd_execution_policy ExecutionPolicy,
-            vir::detail::simd_execution_iterator It>
-    constexpr std::iter_value_t<It>
-    reduce(ExecutionPolicy policy, It first, It last)
+  /// Returns an iterator to the first element matching \p pred (iterator overload)
+  template <detail::simd_execution_policy ExecutionPolicy, detail::simd_execution_iterator It,
+            typename F>
+    constexpr It
+    find_if(ExecutionPolicy pol, It first, It last, F&& pred)
+    { return first + detail::find_if(pol, first, last, pred); }
+
+  /// Returns an iterator to the first element matching \p pred (range overload)
+  template <detail::simd_execution_policy ExecutionPolicy, detail::simd_execution_range R,
+            typename F>
+    constexpr auto
+    find_if(ExecutionPolicy pol, R&& rg, F&& pred)
     {
-      return vir::detail::transform_reduce(policy, first, last, std::iter_value_t<It>{},
-                                           std::plus<>(), [](auto const& x) { return x; });
+      return vir::find_if(pol, std::ranges::begin(rg), std::ranges::end(rg),
+                          std::forward<F>(pred));
     }
 
-  /** \brief Overloads std::reduce for vir::execution::simd.
-   * \ingroup vir_reduce
-   */
-  template <vir::detail::simd_execution_policy ExecutionPolicy,
-            vir::detail::simd_execution_iterator It, typename T>
-    constexpr T
-    reduce(ExecutionPolicy policy, It first, It last, T init)
+  /// Returns an iterator to the first element not matching \p pred (iterator overload)
+  template <detail::simd_execution_policy ExecutionPolicy, detail::simd_execution_iterator It,
+            typename F>
+    constexpr It
+    find_if_not(ExecutionPolicy pol, It first, It last, F&& pred)
     {
-      return vir::detail::transform_reduce(policy, first, last, init, std::plus<>(),
-                                           [](auto const& x) { return x; });
+      return first + detail::find_if(pol, first, last,
+                                     [&](const auto& x) VIR_LAMBDA_ALWAYS_INLINE {
+                                       return not pred(x);
+                                     });
     }
 
-  /** \brief Overloads std::reduce for vir::execution::simd.
-   * \ingroup vir_reduce
-   */
-  template <vir::detail::simd_execution_policy ExecutionPolicy,
-            vir::detail::simd_execution_iterator It, typename T, typename BinaryReductionOp>
-    constexpr T
-    reduce(ExecutionPolicy policy, It first, It last, T init, BinaryReductionOp op)
+  /// Returns an iterator to the first element not matching \p pred (range overload)
+  template <detail::simd_execution_policy ExecutionPolicy, detail::simd_execution_range R,
+            typename F>
+    constexpr auto
+    find_if_not(ExecutionPolicy pol, R&& rg, F&& pred)
     {
-      return vir::detail::transform_reduce(policy, first, last, init, op,
-                                           [](auto const& x) { return x; });
+      return vir::find_if_not(pol, std::ranges::begin(rg), std::ranges::end(rg),
+                              std::forward<F>(pred));
     }
 
-  /** \brief Overloads std::count_if for vir::execution::simd.
-   * \ingroup vir_count_if
-   */
-  template <vir::detail::simd_execution_policy ExecutionPolicy,
-            vir::detail::simd_execution_iterator It, typename F>
-    constexpr int
-    count_if(ExecutionPolicy pol, It first, It last, F&& fun)
-    { return vir::count_if(pol, first, last, std::forward<F>(fun)); }
+  /// Returns whether \p pred matches any element (iterator overload)
+  template <detail::simd_execution_policy ExecutionPolicy, detail::simd_execution_iterator It,
+            typename F>
+    constexpr bool
+    any_of(ExecutionPolicy pol, It first, It last, F&& pred)
+    { return vir::find_if(pol, first, last, std::forward<F>(pred)) != last; }
+
+  /// Returns whether \p pred matches any element (range overload)
+  template <detail::simd_execution_policy ExecutionPolicy, detail::simd_execution_range R,
+            typename F>
+    constexpr bool
+    any_of(ExecutionPolicy pol, R&& rg, F&& pred)
+    {
+      return vir::any_of(pol, std::ranges::begin(rg), std::ranges::end(rg),
+                         std::forward<F>(pred));
+    }
+
+  /// Returns whether \p pred matches all elements (iterator overload)
+  template <detail::simd_execution_policy ExecutionPolicy, detail::simd_execution_iterator It,
+            typename F>
+    constexpr bool
+    all_of(ExecutionPolicy pol, It first, It last, F&& pred)
+    { return vir::find_if_not(pol, first, last, std::forward<F>(pred)) == last; }
+
+  /// Returns whether \p pred matches all elements (range overload)
+  template <detail::simd_execution_policy ExecutionPolicy, detail::simd_execution_range R,
+            typename F>
+    constexpr bool
+    all_of(ExecutionPolicy pol, R&& rg, F&& pred)
+    {
+      return vir::all_of(pol, std::ranges::begin(rg), std::ranges::end(rg),
+                         std::forward<F>(pred));
+    }
+
+  /// Returns whether \p pred matches no element (iterator overload)
+  template <detail::simd_execution_policy ExecutionPolicy, detail::simd_execution_iterator It,
+            typename F>
+    constexpr bool
+    none_of(ExecutionPolicy pol, It first, It last, F&& pred)
+    { return vir::find_if(pol, first, last, std::forward<F>(pred)) == last; }
+
+  /// Returns whether \p pred matches no element (range overload)
+  template <detail::simd_execution_policy ExecutionPolicy, detail::simd_execution_range R,
+            typename F>
+    constexpr bool
+    none_of(ExecutionPolicy pol, R&& rg, F&& pred)
+    {
+      return vir::none_of(pol, std::ranges::begin(rg), std::ranges::end(rg),
+                          std::forward<F>(pred));
+    }
+
+  /**
+   * Returns the first position where \p pred does not match the elements of both ranges (iterator
+   * overload).
+   */
+  template <detail::simd_execution_policy ExecutionPolicy, detail::simd_execution_iterator It1,
+            detail::simd_execution_iterator It2, typename BinaryPredicate>
+    constexpr std::pair<It1, It2>
+    mismatch(ExecutionPolicy pol, It1 first1, It1 last1, It2 first2, BinaryPredicate pred)
+    {
+      const auto n = detail::find_if(pol, first1, last1,
+                                     [&](const auto& x, const auto& y) VIR_LAMBDA_ALWAYS_INLINE {
+                                       return not std::invoke(pred, x, y);
+                                     }, first2);
+      return {first1 + n, first2 + n};
+    }
+
+  /// Returns the first position where the elements of both ranges differ (iterator overload)
+  template <detail::simd_execution_policy ExecutionPolicy, detail::simd_execution_iterator It1,
+            detail::simd_execution_iterator It2>
+    constexpr std::pair<It1, It2>
+    mismatch(ExecutionPolicy pol, It1 first1, It1 last1, It2 first2)
+    { return vir::mismatch(pol, first1, last1, first2, std::equal_to<>()); }
+
+  /// As above, but stops at the end of the shorter range (iterator overload)
+  template <detail::simd_execution_policy ExecutionPolicy, detail::simd_execution_iterator It1,
+            detail::simd_execution_iterator It2, typename BinaryPredicate>
+    constexpr std::pair<It1, It2>
+    mismatch(ExecutionPolicy pol, It1 first1, It1 last1, It2 first2, It2 last2,
+             BinaryPredicate pred)
+    {
+      const auto n = std::min(std::distance(first1, last1), std::distance(first2, last2));
+      return vir::mismatch(pol, first1, first1 + n, first2, pred);
+    }
+
+  /// As above, but stops at the end of the shorter range (iterator overload)
+  template <detail::simd_execution_policy ExecutionPolicy, detail::simd_execution_iterator It1,
+            detail::simd_execution_iterator It2>
+    constexpr std::pair<It1, It2>
+    mismatch(ExecutionPolicy pol, It1 first1, It1 last1, It2 first2, It2 last2)
+    { return vir::mismatch(pol, first1, last1, first2, last2, std::equal_to<>()); }
+
+  /// As above (range overload)
+  template <detail::simd_execution_policy ExecutionPolicy, detail::simd_execution_range R1,
+            detail::simd_execution_range R2, typename BinaryPredicate>
+    constexpr auto
+    mismatch(ExecutionPolicy pol, R1&& rg1, R2&& rg2, BinaryPredicate pred)
+    {
+      return vir::mismatch(pol, std::ranges::begin(rg1), std::ranges::end(rg1),
+                           std::ranges::begin(rg2), std::ranges::end(rg2), pred);
+    }
+
+  /// As above (range overload)
+  template <detail::simd_execution_policy ExecutionPolicy, detail::simd_execution_range R1,
+            detail::simd_execution_range R2>
+    constexpr auto
+    mismatch(ExecutionPolicy pol, R1&& rg1, R2&& rg2)
+    { return vir::mismatch(pol, rg1, rg2, std::equal_to<>()); }
+
+  /// Returns whether \p pred matches all elements of both ranges (iterator overload)
+  template <detail::simd_execution_policy ExecutionPolicy, detail::simd_execution_iterator It1,
+            detail::simd_execution_iterator It2, typename BinaryPredicate>
+    constexpr bool
+    equal(ExecutionPolicy pol, It1 first1, It1 last1, It2 first2, BinaryPredicate pred)
+    { return vir::mismatch(pol, first1, last1, first2, pred).first == last1; }
+
+  /// Returns whether both ranges are equal (iterator overload)
+  template <detail::simd_execution_policy ExecutionPolicy, detail::simd_execution_iterator It1,
+            detail::simd_execution_iterator It2>
+    constexpr bool
+    equal(ExecutionPolicy pol, It1 first1, It1 last1, It2 first2)
+    { return vir::equal(pol, first1, last1, first2, std::equal_to<>()); }
+
+  /// As above, but returns `false` if the range sizes differ (iterator overload)
+  template <detail::simd_execution_policy ExecutionPolicy, detail::simd_execution_iterator It1,
+            detail::simd_execution_iterator It2, typename BinaryPredicate>
+    constexpr bool
+    equal(ExecutionPolicy pol, It1 first1, It1 last1, It2 first2, It2 last2,
+          BinaryPredicate pred)
+    {
+      return std::distance(first1, last1) == std::distance(first2, last2)
+               and vir::equal(pol, first1, last1, first2, pred);
+    }
+
+  /// As above, but returns `false` if the range sizes differ (iterator overload)
+  template <detail::simd_execution_policy ExecutionPolicy, detail::simd_execution_iterator It1,
+            detail::simd_execution_iterator It2>
+    constexpr bool
+    equal(ExecutionPolicy pol, It1 first1, It1 last1, It2 first2, It2 last2)
+    { return vir::equal(pol, first1, last1, first2, last2, std::equal_to<>()); }
+
+  /// As above (range overload)
+  template <detail::simd_execution_policy ExecutionPolicy, detail::simd_execution_range R1,
+            detail::simd_execution_range R2, typename BinaryPredicate>
+    constexpr bool
+    equal(ExecutionPolicy pol, R1&& rg1, R2&& rg2, BinaryPredicate pred)
+    {
+      return vir::equal(pol, std::ranges::begin(rg1), std::ranges::end(rg1),
+                        std::ranges::begin(rg2), std::ranges::end(rg2), pred);
+    }
+
+  /// As above (range overload)
+  template <detail::simd_execution_policy ExecutionPolicy, detail::simd_execution_range R1,
+            detail::simd_execution_range R2>
+    constexpr bool
+    equal(ExecutionPolicy pol, R1&& rg1, R2&& rg2)
+    { return vir::equal(pol, rg1, rg2, std::equal_to<>()); }
+
+  /**@}*/
+
+  namespace detail
+  {
+    /** \internal
+     * Generic simd inclusive/exclusive scan with initial value \p init. Each chunk is scanned
+     * in-register and combined with the result of the preceding chunks (\p carry).
+     */
+    template <bool exclusive, simd_execution_policy ExecutionPolicy,
+              simd_execution_iterator It, simd_execution_iterator OutIt, typename T,
+              typename BinaryOp, typename UnaryOp>
+      constexpr OutIt
+      scan(ExecutionPolicy, It first, It last, OutIt d_first, T init, BinaryOp op,
+           UnaryOp unary_op)
+      {
+        using A1 = vir::simdize<T, 1>;
+        auto out = std::to_address(d_first);
+        A1 carry = init;
+        vir::for_each(sequential_policy_t<ExecutionPolicy>(), first, last,
+                      [&](const auto&... xs) VIR_LAMBDA_ALWAYS_INLINE {
+          ([&](const auto& x) VIR_LAMBDA_ALWAYS_INLINE {
+            using TV = stdx::rebind_simd_t<T, std::remove_cvref_t<decltype(x)>>;
+            constexpr int size = TV::size();
+            const TV p = simd_inclusive_prefix(
+                           stdx::static_simd_cast<TV>(std::invoke(unary_op, x)), op);
+            if constexpr (exclusive)
+              {
+                TV r = std::invoke(op, TV(carry[0]),
+                                   vir::simd_permute(p, vir::simd_permutations::shift<-1>));
+                where(first_n_mask<TV, 1>(), r) = carry[0];
+                r.copy_to(out, stdx::element_aligned);
+                carry = std::invoke(op, carry, A1(p[size - 1]));
+              }
+            else
+              {
+                const TV r = std::invoke(op, TV(carry[0]), p);
+                r.copy_to(out, stdx::element_aligned);
+                carry = r[size - 1];
+              }
+            out += size;
+          }(xs), ...);
+        });
+        return d_first + (out - std::to_address(d_first));
+      }
+  } // namespace detail
+
+  /**
+   * \defgroup vir_scan Algorithm: inclusive_scan, exclusive_scan, transform_inclusive_scan
+   *
+   * \brief Computes prefix sums (or prefix reductions over \p op) of the input range.
+   *
+   * These functions are drop-in replacements for the corresponding std algorithms. The only
+   * difference is that \p op and \p unary_op are called with `simd` arguments. Each chunk is
+   * scanned in-register using log2(`simd::size()`) shift-and-combine steps; the result is combined
+   * with the last element of the preceding chunk. Thus \p op must be associative, but it need not
+   * be commutative. The output range may be equal to the input range.
+   *
+   * The value-type of the input range must be vectorizable (i.e. `simd<T>` is valid).
+   *
+   * \param pol     Needs to be vir::execution::simd or one of the derived types returned from its
+   *                modifiers. (\ref vir::detail::simd_execution_policy)
+   * \param first, last  Iterator pair modelling vir::detail::simd_execution_iterator.
+   * \param rg      Input range modelling vir::detail::simd_execution_range.
+   * \param d_first Output iterator modelling vir::detail::simd_execution_iterator.
+   * \param d_rng   Output range modelling vir::detail::simd_execution_range.
+   * \param init    The initial value of the scan.
+   * \param op      Associative binary operation (default: `std::plus<>`).
+   * \param unary_op Callable that is invoked with a `simd` of input elements, before \p op.
+   *
+   * \return Past-the-end iterator of the output range.
+   * @{
+   */
+  /// Inclusive scan over \p op with initial value \p init (iterator overload)
+  template <detail::simd_execution_policy ExecutionPolicy, detail::simd_execution_iterator It,
+            detail::simd_execution_iterator OutIt, typename BinaryOp, typename T>
+    requires vectorizable<std::iter_value_t<It>>
+    constexpr OutIt
+    inclusive_scan(ExecutionPolicy pol, It first, It last, OutIt d_first, BinaryOp op, T init)
+    {
+      return detail::scan<false>(pol, first, last, d_first, init, op,
+                                 [](const auto& x) { return x; });
+    }
+
+  /// Inclusive scan over \p op (iterator overload)
+  template <detail::simd_execution_policy ExecutionPolicy, detail::simd_execution_iterator It,
+            detail::simd_execution_iterator OutIt, typename BinaryOp>
+    requires vectorizable<std::iter_value_t<It>>
+    constexpr OutIt
+    inclusive_scan(ExecutionPolicy pol, It first, It last, OutIt d_first, BinaryOp op)
+    {
+      if (first == last)
+        return d_first;
+      *d_first = *first;
+      return vir::inclusive_scan(pol, first + 1, last, d_first + 1, op, *first);
+    }
+
+  /// Prefix sum (iterator overload)
+  template <detail::simd_execution_policy ExecutionPolicy, detail::simd_execution_iterator It,
+            detail::simd_execution_iterator OutIt>
+    requires vectorizable<std::iter_value_t<It>>
+    constexpr OutIt
+    inclusive_scan(ExecutionPolicy pol, It first, It last, OutIt d_first)
+    { return vir::inclusive_scan(pol, first, last, d_first, std::plus<>()); }
+
+  /// Inclusive scan over \p op with initial value \p init (range overload)
+  template <detail::simd_execution_policy ExecutionPolicy, detail::simd_execution_range R1,
+            detail::simd_execution_range R2, typename BinaryOp, typename T>
+    requires vectorizable<std::ranges::range_value_t<R1>>
+    constexpr auto
+    inclusive_scan(ExecutionPolicy pol, R1&& rg, R2& d_rng, BinaryOp op, T init)
+    {
+      return vir::inclusive_scan(pol, std::ranges::begin(rg), std::ranges::end(rg),
+                                 std::ranges::begin(d_rng), op, init);
+    }
+
+  /// Inclusive scan over \p op (range overload)
+  template <detail::simd_execution_policy ExecutionPolicy, detail::simd_execution_range R1,
+            detail::simd_execution_range R2, typename BinaryOp>
+    requires vectorizable<std::ranges::range_value_t<R1>>
+    constexpr auto
+    inclusive_scan(ExecutionPolicy pol, R1&& rg, R2& d_rng, BinaryOp op)
+    {
+      return vir::inclusive_scan(pol, std::ranges::begin(rg), std::ranges::end(rg),
+                                 std::ranges::begin(d_rng), op);
+    }
+
+  /// Prefix sum (range overload)
+  template <detail::simd_execution_policy ExecutionPolicy, detail::simd_execution_range R1,
+            detail::simd_execution_range R2>
+    requires vectorizable<std::ranges::range_value_t<R1>>
+    constexpr auto
+    inclusive_scan(ExecutionPolicy pol, R1&& rg, R2& d_rng)
+    { return vir::inclusive_scan(pol, rg, d_rng, std::plus<>()); }
+
+  /// Exclusive scan over \p op with initial value \p init (iterator overload)
+  template <detail::simd_execution_policy ExecutionPolicy, detail::simd_execution_iterator It,
+            detail::simd_execution_iterator OutIt, typename T, typename BinaryOp>
+    requires vectorizable<std::iter_value_t<It>>
+    constexpr OutIt
+    exclusive_scan(ExecutionPolicy pol, It first, It last, OutIt d_first, T init, BinaryOp op)
+    {
+      return detail::scan<true>(pol, first, last, d_first, init, op,
+                                [](const auto& x) { return x; });
+    }
+
+  /// Exclusive prefix sum with initial value \p init (iterator overload)
+  template <detail::simd_execution_policy ExecutionPolicy, detail::simd_execution_iterator It,
+            detail::simd_execution_iterator OutIt, typename T>
+    requires vectorizable<std::iter_value_t<It>>
+    constexpr OutIt
+    exclusive_scan(ExecutionPolicy pol, It first, It last, OutIt d_first, T init)
+    { return vir::exclusive_scan(pol, first, last, d_first, init, std::plus<>()); }
+
+  /// Exclusive scan over \p op with initial value \p init (range overload)
+  template <detail::simd_execution_policy ExecutionPolicy, detail::simd_execution_range R1,
+            detail::simd_execution_range R2, typename T, typename BinaryOp>
+    requires vectorizable<std::ranges::range_value_t<R1>>
+    constexpr auto
+    exclusive_scan(ExecutionPolicy pol, R1&& rg, R2& d_rng, T init, BinaryOp op)
+    {
+      return vir::exclusive_scan(pol, std::ranges::begin(rg), std::ranges::end(rg),
+                                 std::ranges::begin(d_rng), init, op);
+    }
+
+  /// Exclusive prefix sum with initial value \p init (range overload)
+  template <detail::simd_execution_policy ExecutionPolicy, detail::simd_execution_range R1,
+            detail::simd_execution_range R2, typename T>
+    requires vectorizable<std::ranges::range_value_t<R1>>
+    constexpr auto
+    exclusive_scan(ExecutionPolicy pol, R1&& rg, R2& d_rng, T init)
+    { return vir::exclusive_scan(pol, rg, d_rng, init, std::plus<>()); }
+
+  /// Inclusive scan over \p op of \p unary_op applied to the input (iterator overload)
+  template <detail::simd_execution_policy ExecutionPolicy, detail::simd_execution_iterator It,
+            detail::simd_execution_iterator OutIt, typename BinaryOp, typename UnaryOp,
+            typename T>
+    requires vectorizable<std::iter_value_t<It>>
+    constexpr OutIt
+    transform_inclusive_scan(ExecutionPolicy pol, It first, It last, OutIt d_first, BinaryOp op,
+                             UnaryOp unary_op, T init)
+    { return detail::scan<false>(pol, first, last, d_first, init, op, unary_op); }
+
+  /// As above, without initial value (iterator overload)
+  template <detail::simd_execution_policy ExecutionPolicy, detail::simd_execution_iterator It,
+            detail::simd_execution_iterator OutIt, typename BinaryOp, typename UnaryOp>
+    requires vectorizable<std::iter_value_t<It>>
+    constexpr OutIt
+    transform_inclusive_scan(ExecutionPolicy pol, It first, It last, OutIt d_first, BinaryOp op,
+                             UnaryOp unary_op)
+    {
+      if (first == last)
+        return d_first;
+      using V1 = vir::simdize<std::iter_value_t<It>, 1>;
+      const auto x0 = std::invoke(unary_op, V1(std::to_address(first), stdx::element_aligned));
+      *d_first = x0[0];
+      return vir::transform_inclusive_scan(pol, first + 1, last, d_first + 1, op, unary_op,
+                                           std::iter_value_t<OutIt>(x0[0]));
+    }
+
+  /// Inclusive scan over \p op of \p unary_op applied to the input (range overload)
+  template <detail::simd_execution_policy ExecutionPolicy, detail::simd_execution_range R1,
+            detail::simd_execution_range R2, typename BinaryOp, typename UnaryOp, typename T>
+    requires vectorizable<std::ranges::range_value_t<R1>>
+    constexpr auto
+    transform_inclusive_scan(ExecutionPolicy pol, R1&& rg, R2& d_rng, BinaryOp op,
+                             UnaryOp unary_op, T init)
+    {
+      return vir::transform_inclusive_scan(pol, std::ranges::begin(rg), std::ranges::end(rg),
+                                           std::ranges::begin(d_rng), op, unary_op, init);
+    }
+
+  /// As above, without initial value (range overload)
+  template <detail::simd_execution_policy ExecutionPolicy, detail::simd_execution_range R1,
+            detail::simd_execution_range R2, typename BinaryOp, typename UnaryOp>
+    requires vectorizable<std::ranges::range_value_t<R1>>
+    constexpr auto
+    transform_inclusive_scan(ExecutionPolicy pol, R1&& rg, R2& d_rng, BinaryOp op,
+                             UnaryOp unary_op)
+    {
+      return vir::transform_inclusive_scan(pol, std::ranges::begin(rg), std::ranges::end(rg),
+                                           std::ranges::begin(d_rng), op, unary_op);
+    }
+
+  /**@}*/
+
+  /**
+   * \defgroup vir_simd_chunk Range adaptor: simd_chunk
+   *
+   * \brief Presents a contiguous range as a range of `vir::simdize<T, N>` chunks.
+   *
+   * The chunks are loaded on dereference, the same way the algorithms above load their input.
+   * The view is random-access and sized and composes with other views, such as
+   * `std::views::transform`, `std::views::take`, and `std::views::zip`. The chunks are values,
+   * thus the view is read-only. Use vir::for_each or vir::transform to modify a range.
+   *
+   * #### Example
+   * ```
+   * std::vector<float> data = ...;
+   * vir::simdize<float, 8> acc = 0;
+   * for (const auto& x : vir::views::simd_chunk<8>(data))
+   *   acc += x * x;
+   * ```
+   *
+   * @{
+   */
+  /// Determines what vir::views::simd_chunk does with the last `size() % N` elements.
+  enum class simd_chunk_tail
+  {
+    /// The last chunk holds the remaining elements followed by value-initialized elements.
+    pad,
+    /// As `pad`, but every chunk is a vir::masked_chunk where `mask` selects the valid elements.
+    masked,
+    /// The view only holds complete chunks. simd_chunk_view::tail() returns the remaining
+    /// elements.
+    scalar,
+  };
+
+  /// The chunk type of vir::views::simd_chunk with simd_chunk_tail::masked.
+  template <typename V>
+    struct masked_chunk
+    {
+      V value;
+      typename V::mask_type mask;
+    };
+
+  /// View of \p R as chunks of `vir::simdize<range_value_t<R>, N>`.
+  template <std::ranges::view R, int N, simd_chunk_tail Tail>
+    requires std::ranges::contiguous_range<const R> and std::ranges::sized_range<const R>
+               and (Tail != simd_chunk_tail::masked
+                      or vectorizable<std::ranges::range_value_t<R>>)
+    class simd_chunk_view : public std::ranges::view_interface<simd_chunk_view<R, N, Tail>>
+    {
+      using T = std::ranges::range_value_t<R>;
+
+      R _base = R();
+
+    public:
+      using simd_type = vir::simdize<T, N>;
+
+      using chunk_type = std::conditional_t<Tail == simd_chunk_tail::masked,
+                                            masked_chunk<simd_type>, simd_type>;
+
+      static constexpr std::size_t chunk_size = simd_type::size();
+
+      class iterator
+      {
+        const T* _data = nullptr;
+        std::ptrdiff_t _index = 0;
+        std::size_t _size = 0;
+
+      public:
+        using value_type = chunk_type;
+        using difference_type = std::ptrdiff_t;
+        using iterator_concept = std::random_access_iterator_tag;
+        using iterator_category = std::input_iterator_tag;
+
+        iterator() = default;
+
+        /// Refers to the chunk starting at `data[index * chunk_size]` in an array of \p size.
+        constexpr
+        iterator(const T* data, std::size_t size, std::ptrdiff_t index) noexcept
+        : _data(data), _index(index), _size(size)
+        {}
+
+        /// Pointer to the first element of the chunk.
+        constexpr const T*
+        base() const noexcept
+        { return _data + _index * chunk_size; }
+
+        value_type
+        operator*() const
+        {
+          const T* ptr = base();
+          const std::size_t n = _size - _index * chunk_size;
+          if constexpr (Tail == simd_chunk_tail::scalar)
+            return simd_type(ptr, stdx::element_aligned);
+          else if constexpr (Tail == simd_chunk_tail::masked)
+            {
+              if (n >= chunk_size)
+                return {simd_type(ptr, stdx::element_aligned),
+                        typename simd_type::mask_type(true)};
+              else
+                return {detail::masked_load<simd_type>(ptr, n),
+                        detail::first_n_mask<simd_type>(n)};
+            }
+          else if (n >= chunk_size)
+            return simd_type(ptr, stdx::element_aligned);
+          else if constexpr (stdx::is_simd_v<simd_type>)
+            return detail::masked_load<simd_type>(ptr, n);
+          else
+            {
+              T tmp[chunk_size] = {};
+              std::copy_n(ptr, n, tmp);
+              return simd_type(tmp, stdx::element_aligned);
+            }
+        }
+
+        value_type
+        operator[](difference_type n) const
+        { return *(*this + n); }
+
+        constexpr iterator&
+        operator++() noexcept
+        {
+          ++_index;
+          return *this;
+        }
+
+        constexpr iterator
+        operator++(int) noexcept
+        {
+          iterator tmp = *this;
+          ++_index;
+          return tmp;
+        }
+
+        constexpr iterator&
+        operator--() noexcept
+        {
+          --_index;
+          return *this;
+        }
+
+        constexpr iterator
+        operator--(int) noexcept
+        {
+          iterator tmp = *this;
+          --_index;
+          return tmp;
+        }
+
+        constexpr iterator&
+        operator+=(difference_type n) noexcept
+        {
+          _index += n;
+          return *this;
+        }
+
+        constexpr iterator&
+        operator-=(difference_type n) noexcept
+        {
+          _index -= n;
+          return *this;
+        }
+
+        friend constexpr iterator
+        operator+(iterator it, difference_type n) noexcept
+        { return it += n; }
+
+        friend constexpr iterator
+        operator+(difference_type n, iterator it) noexcept
+        { return it += n; }
+
+        friend constexpr iterator
+        operator-(iterator it, difference_type n) noexcept
+        { return it -= n; }
+
+        friend constexpr difference_type
+        operator-(const iterator& a, const iterator& b) noexcept
+        { return a._index - b._index; }
+
+        friend constexpr bool
+        operator==(const iterator& a, const iterator& b) noexcept
+        { return a._index == b._index; }
+
+        friend constexpr auto
+        operator<=>(const iterator& a, const iterator& b) noexcept
+        { return a._index <=> b._index; }
+      };
+
+      simd_chunk_view() requires std::default_initializable<R> = default;
+
+      constexpr explicit
+      simd_chunk_view(R base)
+      : _base(std::move(base))
+      {}
+
+      constexpr R
+      base() const& requires std::copy_constructible<R>
+      { return _base; }
+
+      constexpr R
+      base() &&
+      { return std::move(_base); }
+
+      constexpr iterator
+      begin() const
+      { return {std::ranges::data(_base), std::ranges::size(_base), 0}; }
+
+      constexpr iterator
+      end() const
+      { return begin() + std::ptrdiff_t(size()); }
+
+      /// The number of chunks.
+      constexpr std::size_t
+      size() const
+      {
+        if constexpr (Tail == simd_chunk_tail::scalar)
+          return std::ranges::size(_base) / chunk_size;
+        else
+          return (std::ranges::size(_base) + chunk_size - 1) / chunk_size;
+      }
+
+      /// The elements after the last complete chunk (less than `chunk_size`).
+      constexpr std::span<const T>
+      tail() const requires (Tail == simd_chunk_tail::scalar)
+      {
+        return std::span<const T>(std::ranges::data(_base), std::ranges::size(_base))
+                 .subspan(size() * chunk_size);
+      }
+    };
+
+  namespace detail
+  {
+    template <int N, simd_chunk_tail Tail>
+      struct simd_chunk_fn
+      {
+        template <typename R>
+          using view_type = simd_chunk_view<std::views::all_t<R>, N, Tail>;
+
+        template <std::ranges::viewable_range R>
+          requires requires { typename view_type<R>; }
+          constexpr view_type<R>
+          operator()(R&& r) const
+          { return view_type<R>(std::views::all(static_cast<R&&>(r))); }
+
+        template <std::ranges::viewable_range R>
+          friend constexpr auto
+          operator|(R&& r, simd_chunk_fn fn)
+          -> decltype(fn(static_cast<R&&>(r)))
+          { return fn(static_cast<R&&>(r)); }
+      };
+  } // namespace detail
+
+  namespace views
+  {
+    /**
+     * Range adaptor object for vir::simd_chunk_view. `simd_chunk<N>(r)` and `r | simd_chunk<N>`
+     * present the contiguous range `r` as chunks of `vir::simdize<range_value_t<R>, N>`.
+     * `N = 0` uses the default size of vir::simdize.
+     */
+    template <int N = 0, simd_chunk_tail Tail = simd_chunk_tail::pad>
+      inline constexpr detail::simd_chunk_fn<N, Tail> simd_chunk {};
+  } // namespace views
+
+  /**@}*/
+}  // namespace vir
+
+/// \internal
+namespace std
+{
+  /** \brief Overloads std::for_each for vir::execution::simd.
+   * \ingroup vir_for_each
+   */
+  template <vir::detail::simd_execution_policy ExecutionPolicy,
+            vir::detail::simd_execution_gatherable_iterator It, typename F>
+    constexpr void
+    for_each(ExecutionPolicy pol, It first, It last, F&& fun)
+    { vir::for_each(pol, first, last, std::forward<F>(fun)); }
+
+  /** \brief Overloads std::transform for vir::execution::simd.
+   * \ingroup vir_transform
+   */
+  template<vir::detail::simd_execution_policy ExecutionPolicy,
+           vir::detail::simd_execution_gatherable_iterator It1,
+           vir::detail::simd_execution_gatherable_iterator OutIt, typename UnaryOperation>
+    constexpr OutIt
+    transform(ExecutionPolicy pol, It1 first1, It1 last1, OutIt d_first, UnaryOperation unary_op)
+    { return vir::detail::transform(pol, first1, last1, d_first, unary_op); }
+
+  /** \brief Overloads std::transform for vir::execution::simd.
+   * \ingroup vir_transform
+   */
+  template<vir::detail::simd_execution_policy ExecutionPolicy,
+           vir::detail::simd_execution_gatherable_iterator It1,
+           vir::detail::simd_execution_gatherable_iterator It2,
+           vir::detail::simd_execution_gatherable_iterator OutIt, typename BinaryOperation>
+    constexpr OutIt
+    transform(ExecutionPolicy pol, It1 first1, It1 last1, It2 first2, OutIt d_first,
+              BinaryOperation binary_op)
+    { return vir::detail::transform(pol, first1, last1, d_first, binary_op, first2); }
+
+
+  /** \brief Overloads std::transform_reduce for vir::execution::simd.
+   * \ingroup vir_transform_reduce
+   */
+  template <vir::detail::simd_execution_policy ExecutionPolicy,
+            vir::detail::simd_execution_gatherable_iterator It1,
+            vir::detail::simd_execution_gatherable_iterator It2, typename T>
+    constexpr T
+    transform_reduce(ExecutionPolicy policy, It1 first1, It1 last1, It2 first2, T init)
+    {
+      return vir::detail::transform_reduce(policy, first1, last1, init, std::plus<>(),
+                                           std::multiplies<>(), first2);
+    }
+
+  /** \brief Overloads std::transform_reduce for vir::execution::simd.
+   * \ingroup vir_transform_reduce
+   */
+  template <vir::detail::simd_execution_policy ExecutionPolicy,
+            vir::detail::simd_execution_gatherable_iterator It1,
+            vir::detail::simd_execution_gatherable_iterator It2, typename T,
+            typename BinaryReductionOp, typename BinaryTransformOp>
+    constexpr T
+    transform_reduce(ExecutionPolicy policy, It1 first1, It1 last1, It2 first2, T init,
+                 BinaryReductionOp reduce_op, BinaryTransformOp transform_op)
+    {
+      return vir::detail::transform_reduce(policy, first1, last1, init, reduce_op, transform_op,
+                                           first2);
+    }
+
+  /** \brief Overloads std::transform_reduce for vir::execution::simd.
+   * \ingroup vir_transform_reduce
+   */
+  template <vir::detail::simd_execution_policy ExecutionPolicy,
+            vir::detail::simd_execution_gatherable_iterator It, typename T,
+            typename BinaryReductionOp, typename UnaryTransformOp>
+    constexpr T
+    transform_reduce(ExecutionPolicy policy, It first1, It last1, T init,
+                     BinaryReductionOp reduce_op, UnaryTransformOp transform_op)
+    { return vir::detail::transform_reduce(policy, first1, last1, init, reduce_op, transform_op); }
+
+  /** \brief Overloads std::reduce for vir::execution::simd.
+   * \ingroup vir_reduce
+   */
+  template <vir::detail::simd_execution_policy ExecutionPolicy,
+            vir::detail::simd_execution_gatherable_iterator It>
+    constexpr std::iter_value_t<It>
+    reduce(ExecutionPolicy policy, It first, It last)
+    {
+      return vir::detail::transform_reduce(policy, first, last, std::iter_value_t<It>{},
+                                           std::plus<>(), [](auto const& x) { return x; });
+    }
+
+  /** \brief Overloads std::reduce for vir::execution::simd.
+   * \ingroup vir_reduce
+   */
+  template <vir::detail::simd_execution_policy ExecutionPolicy,
+            vir::detail::simd_execution_gatherable_iterator It, typename T>
+    constexpr T
+    reduce(ExecutionPolicy policy, It first, It last, T init)
+    {
+      return vir::detail::transform_reduce(policy, first, last, init, std::plus<>(),
+                                           [](auto const& x) { return x; });
+    }
+
+  /** \brief Overloads std::reduce for vir::execution::simd.
+   * \ingroup vir_reduce
+   */
+  template <vir::detail::simd_execution_policy ExecutionPolicy,
+            vir::detail::simd_execution_gatherable_iterator It, typename T,
+            typename BinaryReductionOp>
+    constexpr T
+    reduce(ExecutionPolicy policy, It first, It last, T init, BinaryReductionOp op)
+    {
+      return vir::detail::transform_reduce(policy, first, last, init, op,
+                                           [](auto const& x) { return x; });
+    }
+
+  /** \brief Overloads std::count_if for vir::execution::simd.
+   * \ingroup vir_count_if
+   */
+  template <vir::detail::simd_execution_policy ExecutionPolicy,
+            vir::detail::simd_execution_iterator It, typename F>
+    constexpr int
+    count_if(ExecutionPolicy pol, It first, It last, F&& fun)
+    { return vir::count_if(pol, first, last, std::forward<F>(fun)); }
+
+  /** \brief Overloads std::copy_if for vir::execution::simd.
+   * \ingroup vir_copy_if
+   */
+  template <vir::detail::simd_execution_policy ExecutionPolicy,
+            vir::detail::simd_execution_iterator It, vir::detail::simd_execution_iterator OutIt,
+            typename F>
+    requires vir::vectorizable<std::iter_value_t<It>>
+    constexpr OutIt
+    copy_if(ExecutionPolicy pol, It first, It last, OutIt d_first, F&& pred)
+    { return vir::copy_if(pol, first, last, d_first, std::forward<F>(pred)); }
+
+  /** \brief Overloads std::remove_if for vir::execution::simd.
+   * \ingroup vir_copy_if
+   */
+  template <vir::detail::simd_execution_policy ExecutionPolicy,
+            vir::detail::simd_execution_iterator It, typename F>
+    requires vir::vectorizable<std::iter_value_t<It>>
+    constexpr It
+    remove_if(ExecutionPolicy pol, It first, It last, F&& pred)
+    { return vir::remove_if(pol, first, last, std::forward<F>(pred)); }
+
+  /** \brief Overloads std::partition_copy for vir::execution::simd.
+   * \ingroup vir_copy_if
+   */
+  template <vir::detail::simd_execution_policy ExecutionPolicy,
+            vir::detail::simd_execution_iterator It, vir::detail::simd_execution_iterator OutIt1,
+            vir::detail::simd_execution_iterator OutIt2, typename F>
+    requires vir::vectorizable<std::iter_value_t<It>>
+    constexpr std::pair<OutIt1, OutIt2>
+    partition_copy(ExecutionPolicy pol, It first, It last, OutIt1 d_first_true,
+                   OutIt2 d_first_false, F&& pred)
+    {
+      return vir::partition_copy(pol, first, last, d_first_true, d_first_false,
+                                 std::forward<F>(pred));
+    }
+
+  /** \brief Overloads std::find_if for vir::execution::simd.
+   * \ingroup vir_find_if
+   */
+  template <vir::detail::simd_execution_policy ExecutionPolicy,
+            vir::detail::simd_execution_iterator It, typename F>
+    constexpr It
+    find_if(ExecutionPolicy pol, It first, It last, F&& pred)
+    { return vir::find_if(pol, first, last, std::forward<F>(pred)); }
+
+  /** \brief Overloads std::find_if_not for vir::execution::simd.
+   * \ingroup vir_find_if
+   */
+  template <vir::detail::simd_execution_policy ExecutionPolicy,
+            vir::detail::simd_execution_iterator It, typename F>
+    constexpr It
+    find_if_not(ExecutionPolicy pol, It first, It last, F&& pred)
+    { return vir::find_if_not(pol, first, last, std::forward<F>(pred)); }
+
+  /** \brief Overloads std::any_of for vir::execution::simd.
+   * \ingroup vir_find_if
+   */
+  template <vir::detail::simd_execution_policy ExecutionPolicy,
+            vir::detail::simd_execution_iterator It, typename F>
+    constexpr bool
+    any_of(ExecutionPolicy pol, It first, It last, F&& pred)
+    { return vir::any_of(pol, first, last, std::forward<F>(pred)); }
+
+  /** \brief Overloads std::all_of for vir::execution::simd.
+   * \ingroup vir_find_if
+   */
+  template <vir::detail::simd_execution_policy ExecutionPolicy,
+            vir::detail::simd_execution_iterator It, typename F>
+    constexpr bool
+    all_of(ExecutionPolicy pol, It first, It last, F&& pred)
+    { return vir::all_of(pol, first, last, std::forward<F>(pred)); }
+
+  /** \brief Overloads std::none_of for vir::execution::simd.
+   * \ingroup vir_find_if
+   */
+  template <vir::detail::simd_execution_policy ExecutionPolicy,
+            vir::detail::simd_execution_iterator It, typename F>
+    constexpr bool
+    none_of(ExecutionPolicy pol, It first, It last, F&& pred)
+    { return vir::none_of(pol, first, last, std::forward<F>(pred)); }
+
+  /** \brief Overloads std::mismatch for vir::execution::simd.
+   * \ingroup vir_find_if
+   */
+  template <vir::detail::simd_execution_policy ExecutionPolicy,
+            vir::detail::simd_execution_iterator It1, vir::detail::simd_execution_iterator It2>
+    constexpr std::pair<It1, It2>
+    mismatch(ExecutionPolicy pol, It1 first1, It1 last1, It2 first2)
+    { return vir::mismatch(pol, first1, last1, first2); }
+
+  /** \brief Overloads std::mismatch for vir::execution::simd.
+   * \ingroup vir_find_if
+   */
+  template <vir::detail::simd_execution_policy ExecutionPolicy,
+            vir::detail::simd_execution_iterator It1, vir::detail::simd_execution_iterator It2,
+            typename BinaryPredicate>
+    constexpr std::pair<It1, It2>
+    mismatch(ExecutionPolicy pol, It1 first1, It1 last1, It2 first2, BinaryPredicate pred)
+    { return vir::mismatch(pol, first1, last1, first2, pred); }
+
+  /** \brief Overloads std::mismatch for vir::execution::simd.
+   * \ingroup vir_find_if
+   */
+  template <vir::detail::simd_execution_policy ExecutionPolicy,
+            vir::detail::simd_execution_iterator It1, vir::detail::simd_execution_iterator It2>
+    constexpr std::pair<It1, It2>
+    mismatch(ExecutionPolicy pol, It1 first1, It1 last1, It2 first2, It2 last2)
+    { return vir::mismatch(pol, first1, last1, first2, last2); }
+
+  /** \brief Overloads std::mismatch for vir::execution::simd.
+   * \ingroup vir_find_if
+   */
+  template <vir::detail::simd_execution_policy ExecutionPolicy,
+            vir::detail::simd_execution_iterator It1, vir::detail::simd_execution_iterator It2,
+            typename BinaryPredicate>
+    constexpr std::pair<It1, It2>
+    mismatch(ExecutionPolicy pol, It1 first1, It1 last1, It2 first2, It2 last2,
+            BinaryPredicate pred)
+    { return vir::mismatch(pol, first1, last1, first2, last2, pred); }
+
+  /** \brief Overloads std::equal for vir::execution::simd.
+   * \ingroup vir_find_if
+   */
+  template <vir::detail::simd_execution_policy ExecutionPolicy,
+            vir::detail::simd_execution_iterator It1, vir::detail::simd_execution_iterator It2>
+    constexpr bool
+    equal(ExecutionPolicy pol, It1 first1, It1 last1, It2 first2)
+    { return vir::equal(pol, first1, last1, first2); }
+
+  /** \brief Overloads std::equal for vir::execution::simd.
+   * \ingroup vir_find_if
+   */
+  template <vir::detail::simd_execution_policy ExecutionPolicy,
+            vir::detail::simd_execution_iterator It1, vir::detail::simd_execution_iterator It2,
+            typename BinaryPredicate>
+    constexpr bool
+    equal(ExecutionPolicy pol, It1 first1, It1 last1, It2 first2, BinaryPredicate pred)
+    { return vir::equal(pol, first1, last1, first2, pred); }
+
+  /** \brief Overloads std::equal for vir::execution::simd.
+   * \ingroup vir_find_if
+   */
+  template <vir::detail::simd_execution_policy ExecutionPolicy,
+            vir::detail::simd_execution_iterator It1, vir::detail::simd_execution_iterator It2>
+    constexpr bool
+    equal(ExecutionPolicy pol, It1 first1, It1 last1, It2 first2, It2 last2)
+    { return vir::equal(pol, first1, last1, first2, last2); }
+
+  /** \brief Overloads std::equal for vir::execution::simd.
+   * \ingroup vir_find_if
+   */
+  template <vir::detail::simd_execution_policy ExecutionPolicy,
+            vir::detail::simd_execution_iterator It1, vir::detail::simd_execution_iterator It2,
+            typename BinaryPredicate>
+    constexpr bool
+    equal(ExecutionPolicy pol, It1 first1, It1 last1, It2 first2, It2 last2,
+         BinaryPredicate pred)
+    { return vir::equal(pol, first1, last1, first2, last2, pred); }
+
+  /** \brief Overloads std::inclusive_scan for vir::execution::simd.
+   * \ingroup vir_scan
+   */
+  template <vir::detail::simd_execution_policy ExecutionPolicy,
+            vir::detail::simd_execution_iterator It, vir::detail::simd_execution_iterator OutIt>
+    requires vir::vectorizable<std::iter_value_t<It>>
+    constexpr OutIt
+    inclusive_scan(ExecutionPolicy pol, It first, It last, OutIt d_first)
+    { return vir::inclusive_scan(pol, first, last, d_first); }
+
+  /** \brief Overloads std::inclusive_scan for vir::execution::simd.
+   * \ingroup vir_scan
+   */
+  template <vir::detail::simd_execution_policy ExecutionPolicy,
+            vir::detail::simd_execution_iterator It, vir::detail::simd_execution_iterator OutIt,
+            typename BinaryOp>
+    requires vir::vectorizable<std::iter_value_t<It>>
+    constexpr OutIt
+    inclusive_scan(ExecutionPolicy pol, It first, It last, OutIt d_first, BinaryOp op)
+    { return vir::inclusive_scan(pol, first, last, d_first, op); }
+
+  /** \brief Overloads std::inclusive_scan for vir::execution::simd.
+   * \ingroup vir_scan
+   */
+  template <vir::detail::simd_execution_policy ExecutionPolicy,
+            vir::detail::simd_execution_iterator It, vir::detail::simd_execution_iterator OutIt,
+            typename BinaryOp, typename T>
+    requires vir::vectorizable<std::iter_value_t<It>>
+    constexpr OutIt
+    inclusive_scan(ExecutionPolicy pol, It first, It last, OutIt d_first, BinaryOp op, T init)
+    { return vir::inclusive_scan(pol, first, last, d_first, op, init); }
+
+  /** \brief Overloads std::exclusive_scan for vir::execution::simd.
+   * \ingroup vir_scan
+   */
+  template <vir::detail::simd_execution_policy ExecutionPolicy,
+            vir::detail::simd_execution_iterator It, vir::detail::simd_execution_iterator OutIt,
+            typename T>
+    requires vir::vectorizable<std::iter_value_t<It>>
+    constexpr OutIt
+    exclusive_scan(ExecutionPolicy pol, It first, It last, OutIt d_first, T init)
+    { return vir::exclusive_scan(pol, first, last, d_first, init); }
+
+  /** \brief Overloads std::exclusive_scan for vir::execution::simd.
+   * \ingroup vir_scan
+   */
+  template <vir::detail::simd_execution_policy ExecutionPolicy,
+            vir::detail::simd_execution_iterator It, vir::detail::simd_execution_iterator OutIt,
+            typename T, typename BinaryOp>
+    requires vir::vectorizable<std::iter_value_t<It>>
+    constexpr OutIt
+    exclusive_scan(ExecutionPolicy pol, It first, It last, OutIt d_first, T init, BinaryOp op)
+    { return vir::exclusive_scan(pol, first, last, d_first, init, op); }
+
+  /** \brief Overloads std::transform_inclusive_scan for vir::execution::simd.
+   * \ingroup vir_scan
+   */
+  template <vir::detail::simd_execution_policy ExecutionPolicy,
+            vir::detail::simd_execution_iterator It, vir::detail::simd_execution_iterator OutIt,
+            typename BinaryOp, typename UnaryOp>
+    requires vir::vectorizable<std::iter_value_t<It>>
+    constexpr OutIt
+    transform_inclusive_scan(ExecutionPolicy pol, It first, It last, OutIt d_first, BinaryOp op,
+                             UnaryOp unary_op)
+    { return vir::transform_inclusive_scan(pol, first, last, d_first, op, unary_op); }
+
+  /** \brief Overloads std::transform_inclusive_scan for vir::execution::simd.
+   * \ingroup vir_scan
+   */
+  template <vir::detail::simd_execution_policy ExecutionPolicy,
+            vir::detail::simd_execution_iterator It, vir::detail::simd_execution_iterator OutIt,
+            typename BinaryOp, typename UnaryOp, typename T>
+    requires vir::vectorizable<std::iter_value_t<It>>
+    constexpr OutIt
+    transform_inclusive_scan(ExecutionPolicy pol, It first, It last, OutIt d_first, BinaryOp op,
+                             UnaryOp unary_op, T init)
+    { return vir::transform_inclusive_scan(pol, first, last, d_first, op, unary_op, init); }
 }
 #endif // no Clang < 17
 #endif // VIR_HAVE_SIMD_CONCEPTS
@@ -18,8 +18,12 @@
 #define VIR_HAVE_SIMD_PERMUTE 1
 
 #include "simd.h"
+#include "simd_bitset.h"
 #include "constexpr_wrapper.h"
+#include "detail.h"
+#include <array>
 #include <bit>
+#include <cstring>
 
 namespace vir
 {
@@ -329,6 +333,604 @@ namespace vir
 		 return a[w + j];
       });
     }
+
+  namespace detail
+  {
+    template <typename W>
+      VIR_ALWAYS_INLINE constexpr const auto&
+      where_mask(const W& w)
+      {
+#if VIR_GLIBCXX_STDX_SIMD
+	return __get_mask(w);
+#else
+	return get_mask(w);
+#endif
+      }
+
+    template <typename W>
+      VIR_ALWAYS_INLINE constexpr auto&
+      where_value(W& w)
+      {
+#if VIR_GLIBCXX_STDX_SIMD
+	return __get_lvalue(w);
+#else
+	return get_lvalue(w);
+#endif
+      }
+
+    /* Satisfied if \p I can be used as the index vector for gathering/scattering \p V.
+     */
+    template <typename I, typename V>
+      concept simd_index_for = any_simd<I> and std::integral<typename I::value_type>
+				 and I::size() == V::size();
+
+#if defined __GNUC__ and not defined __clang__ and defined __AVX2__
+    /* Determines whether x86 gather/scatter instructions can be used for reading/writing values
+     * of type \p T with a `simd<T>` of \p N elements and index type \p IT.
+     *
+     * Scatter instructions require AVX-512 (F for 512-bit, VL for smaller vectors). Gathers of
+     * two elements or 128-bit index vectors with 64-bit elements are not worth it and therefore
+     * use the scalar implementation.
+     */
+    template <typename T, typename IT, int N, bool Scatter>
+      constexpr bool have_x86_gather_scatter
+	= vectorizable<T> and (sizeof(T) == 4 or sizeof(T) == 8)
+	    and std::is_signed_v<IT> and sizeof(IT) == 4
+	    and N >= 4 and std::has_single_bit(unsigned(N)) and sizeof(T) * N <= 64
+#ifdef __AVX512F__
+	    and (sizeof(T) * N == 64 or not Scatter
+#ifdef __AVX512VL__
+		   or true
+#endif
+		)
+#else
+	    and sizeof(T) * N <= 32 and not Scatter
+#endif
+	;
+
+    template <typename V, typename I>
+      concept x86_gather_args
+	= have_x86_gather_scatter<typename V::value_type, typename I::value_type, V::size(), false>
+	    and sizeof(V) == sizeof(typename V::value_type) * V::size()
+	    and sizeof(I) == sizeof(typename I::value_type) * I::size()
+	    and std::is_trivially_copyable_v<V> and std::is_trivially_copyable_v<I>;
+
+    template <typename V, typename I>
+      concept x86_scatter_args
+	= x86_gather_args<V, I>
+	    and have_x86_gather_scatter<typename V::value_type, typename I::value_type,
+					V::size(), true>;
+
+    /* Returns the `vector_size` builtin type of \p N elements with the same size as \p T. Integers
+     * are mapped to int/long long because that's what the x86 builtins use.
+     */
+    template <typename T>
+      using x86_gather_value_type
+	= std::conditional_t<std::is_floating_point_v<T>, T,
+			     std::conditional_t<sizeof(T) == 4, int, long long>>;
+
+    /* Gather into the elements of \p v selected by \p k (or all elements if not \p Masked)
+     * using the x86 builtins.
+     */
+    template <bool Masked, typename V, typename I>
+      VIR_ALWAYS_INLINE V
+      x86_gather(const V& v, const typename V::mask_type& k, const typename V::value_type* base,
+		 const I& idx)
+      {
+	using T = typename V::value_type;
+	using F = x86_gather_value_type<T>;
+	constexpr int N = V::size();
+	using DataVec [[gnu::vector_size(sizeof(T) * N)]] = F;
+	using IdxVec [[gnu::vector_size(4 * N)]] = int;
+	const F* ptr = reinterpret_cast<const F*>(base);
+	const DataVec src = vir::detail::bit_cast<DataVec>(v);
+	const IdxVec vidx = vir::detail::bit_cast<IdxVec>(idx);
+	DataVec r;
+#ifdef __AVX512F__
+	if constexpr (sizeof(DataVec) == 64)
+	  {
+	    using Bits = std::conditional_t<N == 16, unsigned short, unsigned char>;
+	    const Bits bits = Masked ? vir::to_bitset(k).to_ullong() : Bits(~0u);
+	    if constexpr (std::is_same_v<F, float>)
+	      r = __builtin_ia32_gathersiv16sf(src, ptr, vidx, bits, sizeof(T));
+	    else if constexpr (std::is_same_v<F, double>)
+	      r = __builtin_ia32_gathersiv8df(src, ptr, vidx, bits, sizeof(T));
+	    else if constexpr (std::is_same_v<F, int>)
+	      r = __builtin_ia32_gathersiv16si(src, ptr, vidx, bits, sizeof(T));
+	    else
+	      r = __builtin_ia32_gathersiv8di(src, ptr, vidx, bits, sizeof(T));
+	    return vir::detail::bit_cast<V>(r);
+	  }
+	else
+#endif
+	  {
+	    // AVX2 gathers use the sign bit of each element as mask; -1 has the sign bit set for
+	    // integers and floating-point.
+	    V ones = T(-1);
+	    if constexpr (Masked)
+	      stdx::where(not k, ones) = T();
+	    const DataVec mask = vir::detail::bit_cast<DataVec>(ones);
+	    if constexpr (std::is_same_v<F, float> and N == 8)
+	      r = __builtin_ia32_gathersiv8sf(src, ptr, vidx, mask, sizeof(T));
+	    else if constexpr (std::is_same_v<F, float>)
+	      r = __builtin_ia32_gathersiv4sf(src, ptr, vidx, mask, sizeof(T));
+	    else if constexpr (std::is_same_v<F, double>)
+	      r = __builtin_ia32_gathersiv4df(src, ptr, vidx, mask, sizeof(T));
+	    else if constexpr (std::is_same_v<F, int> and N == 8)
+	      r = __builtin_ia32_gathersiv8si(src, ptr, vidx, mask, sizeof(T));
+	    else if constexpr (std::is_same_v<F, int>)
+	      r = __builtin_ia32_gathersiv4si(src, ptr, vidx, mask, sizeof(T));
+	    else
+	      r = __builtin_ia32_gathersiv4di(src, ptr, vidx, mask, sizeof(T));
+	    return vir::detail::bit_cast<V>(r);
+	  }
+      }
+
+    /* Scatter the elements of \p v selected by \p k (or all elements if not \p Masked) using the
+     * x86 builtins.
+     */
+    template <bool Masked, typename V, typename I>
+      VIR_ALWAYS_INLINE void
+      x86_scatter(const V& v, const typename V::mask_type& k, typename V::value_type* base,
+		  const I& idx)
+      {
+	using T = typename V::value_type;
+	using F = x86_gather_value_type<T>;
+	constexpr int N = V::size();
+	using DataVec [[gnu::vector_size(sizeof(T) * N)]] = F;
+	using IdxVec [[gnu::vector_size(4 * N)]] = int;
+	void* ptr = base;
+	const DataVec data = vir::detail::bit_cast<DataVec>(v);
+	const IdxVec vidx = vir::detail::bit_cast<IdxVec>(idx);
+	using Bits = std::conditional_t<N == 16, unsigned short, unsigned char>;
+	const Bits bits = Masked ? vir::to_bitset(k).to_ullong() : Bits(~0u);
+	if constexpr (std::is_same_v<F, float> and N == 16)
+	  __builtin_ia32_scattersiv16sf(ptr, bits, vidx, data, sizeof(T));
+	else if constexpr (std::is_same_v<F, int> and N == 16)
+	  __builtin_ia32_scattersiv16si(ptr, bits, vidx, data, sizeof(T));
+	else if constexpr (std::is_same_v<F, double> and N == 8)
+	  __builtin_ia32_scattersiv8df(ptr, bits, vidx, data, sizeof(T));
+	else if constexpr (std::is_same_v<F, long long> and N == 8)
+	  __builtin_ia32_scattersiv8di(ptr, bits, vidx, data, sizeof(T));
+#ifdef __AVX512VL__
+	else if constexpr (std::is_same_v<F, float> and N == 8)
+	  __builtin_ia32_scattersiv8sf(ptr, bits, vidx, data, sizeof(T));
+	else if constexpr (std::is_same_v<F, float>)
+	  __builtin_ia32_scattersiv4sf(ptr, bits, vidx, data, sizeof(T));
+	else if constexpr (std::is_same_v<F, int> and N == 8)
+	  __builtin_ia32_scattersiv8si(ptr, bits, vidx, data, sizeof(T));
+	else if constexpr (std::is_same_v<F, int>)
+	  __builtin_ia32_scattersiv4si(ptr, bits, vidx, data, sizeof(T));
+	else if constexpr (std::is_same_v<F, double>)
+	  __builtin_ia32_scattersiv4df(ptr, bits, vidx, data, sizeof(T));
+	else if constexpr (std::is_same_v<F, long long>)
+	  __builtin_ia32_scattersiv4di(ptr, bits, vidx, data, sizeof(T));
+#endif
+	else
+	  static_assert(N == 0, "unreachable: have_x86_gather_scatter is inconsistent");
+      }
+#endif // __AVX2__
+  }
+
+  /** \brief Load `base[idx[i]]` into element `i` of the returned simd.
+   *
+   * \tparam V  The return type. Defaults to a simd with value type \p T and the same width and
+   *            ABI as \p I.
+   *
+   * \param base  Pointer to the first element of the lookup table.
+   * \param idx   The indexes into \p base. Every `base + idx[i]` must be dereferenceable.
+   */
+  template <typename V = void, vectorizable T, any_simd I,
+	    typename R = std::conditional_t<std::is_void_v<V>, stdx::rebind_simd_t<T, I>, V>>
+    requires any_simd<R> and detail::simd_index_for<I, R>
+    VIR_ALWAYS_INLINE constexpr R
+    simd_gather(const T* base, const I& idx)
+    {
+#if defined __GNUC__ and not defined __clang__ and defined __AVX2__
+      if constexpr (std::is_same_v<typename R::value_type, T> and detail::x86_gather_args<R, I>)
+	if (not std::is_constant_evaluated())
+	  return detail::x86_gather<false>(R(), typename R::mask_type(true), base, idx);
+#endif
+      return R([&](auto i) {
+	       return static_cast<typename R::value_type>(base[idx[i]]);
+	     });
+    }
+
+  /** \brief Masked gather: Load `base[idx[i]]` into element `i` of the `simd` object in \p w
+   * for all elements `i` where the mask in \p w is `true`.
+   *
+   * Elements where the mask is `false` are left unchanged and do not access memory. Example:
+   * \code
+   * vir::simd_gather(stdx::where(idx < size, x), table, idx);
+   * \endcode
+   */
+  template <typename M, any_simd V, vectorizable T, detail::simd_index_for<V> I>
+    requires std::same_as<M, typename V::mask_type>
+    VIR_ALWAYS_INLINE constexpr void
+    simd_gather(stdx::where_expression<M, V>&& w, const T* base, const I& idx)
+    {
+      const M& k = detail::where_mask(w);
+      V& v = detail::where_value(w);
+#if defined __GNUC__ and not defined __clang__ and defined __AVX2__
+      if constexpr (std::is_same_v<typename V::value_type, T> and detail::x86_gather_args<V, I>)
+	if (not std::is_constant_evaluated())
+	  {
+	    v = detail::x86_gather<true>(v, k, base, idx);
+	    return;
+	  }
+#endif
+      stdx::where(k, v) = V([&](auto i) -> typename V::value_type {
+			    return k[i] ? static_cast<typename V::value_type>(base[idx[i]]) : 0;
+			  });
+    }
+
+  /** \brief Store element `i` of \p v to `base[idx[i]]`.
+   *
+   * If several elements of \p idx are equal, the element with the highest index in \p v is
+   * stored last (and thus wins).
+   */
+  template <any_simd V, vectorizable T, detail::simd_index_for<V> I>
+    VIR_ALWAYS_INLINE constexpr void
+    simd_scatter(const V& v, T* base, const I& idx)
+    {
+#if defined __GNUC__ and not defined __clang__ and defined __AVX2__
+      if constexpr (std::is_same_v<typename V::value_type, T> and detail::x86_scatter_args<V, I>)
+	if (not std::is_constant_evaluated())
+	  return detail::x86_scatter<false>(v, typename V::mask_type(true), base, idx);
+#endif
+      for (std::size_t i = 0; i < V::size(); ++i)
+	base[idx[i]] = static_cast<T>(v[i]);
+    }
+
+  /** \brief Masked scatter: Store element `i` of the `simd` object in \p w to `base[idx[i]]` for
+   * all elements `i` where the mask in \p w is `true`.
+   *
+   * Elements where the mask is `false` do not access memory.
+   */
+  template <typename M, any_simd V, vectorizable T, detail::simd_index_for<V> I>
+    requires std::same_as<M, typename V::mask_type>
+    VIR_ALWAYS_INLINE constexpr void
+    simd_scatter(const stdx::const_where_expression<M, V>& w, T* base, const I& idx)
+    {
+      const M& k = detail::where_mask(w);
+      const V& v = detail::where_value(w);
+#if defined __GNUC__ and not defined __clang__ and defined __AVX2__
+      if constexpr (std::is_same_v<typename V::value_type, T> and detail::x86_scatter_args<V, I>)
+	if (not std::is_constant_evaluated())
+	  return detail::x86_scatter<true>(v, k, base, idx);
+#endif
+      for (std::size_t i = 0; i < V::size(); ++i)
+	if (k[i])
+	  base[idx[i]] = static_cast<T>(v[i]);
+    }
+
+  namespace detail
+  {
+    /* Signed integer type with the given size, as used for x86 builtins and shuffle indexes.
+     */
+    template <std::size_t Size>
+      using sized_int_t
+	= std::conditional_t<Size == 1, signed char,
+			     std::conditional_t<Size == 2, short,
+						std::conditional_t<Size == 4, int, long long>>>;
+
+    /* Table of shuffle indexes for compressing: Row `bits` lists the indexes of the set bits.
+     * The remaining indexes are irrelevant because those elements are not stored.
+     */
+    template <int N>
+      inline constexpr auto compress_lut = [] {
+	std::array<std::array<unsigned char, N>, (1u << N)> lut = {};
+	for (unsigned bits = 0; bits < (1u << N); ++bits)
+	  {
+	    int j = 0;
+	    for (int i = 0; i < N; ++i)
+	      if (bits & (1u << i))
+		lut[bits][j++] = i;
+	  }
+	return lut;
+      }();
+
+    /* Table of shuffle indexes for expanding: Row `bits` maps every set bit `i` to the number of
+     * set bits below `i` and every unset bit to `N - 1`. The latter is only used if not all bits
+     * are set, in which case element `N - 1` was not loaded and thus is 0.
+     */
+    template <int N>
+      inline constexpr auto expand_lut = [] {
+	std::array<std::array<unsigned char, N>, (1u << N)> lut = {};
+	for (unsigned bits = 0; bits < (1u << N); ++bits)
+	  for (int i = 0, j = 0; i < N; ++i)
+	    lut[bits][i] = (bits & (1u << i)) ? j++ : N - 1;
+	return lut;
+      }();
+
+#if defined __GNUC__ and not defined __clang__
+    /* Returns the mask as integer with bit i set iff k[i] is true.
+     *
+     * GCC 12 may spill a zero-extended AVX-512 mask register with a narrow kmov and reload it
+     * with full width. Therefore, the empty asm moves the bits of exactly M::size() width into a
+     * general purpose register before they are zero-extended.
+     */
+    template <typename M>
+      VIR_ALWAYS_INLINE unsigned long long
+      mask_to_bits(const M& k)
+      {
+	constexpr int N = M::size();
+	using Bits = std::conditional_t<N <= 8, unsigned char,
+					std::conditional_t<N <= 16, unsigned short,
+							   std::conditional_t<N <= 32, unsigned,
+									      unsigned long long>>>;
+	Bits bits = vir::to_bitset(k).to_ullong();
+#ifdef __AVX512F__
+	asm("" : "+r"(bits));
+#endif
+	return bits;
+      }
+
+    /* Whether vcompress/vexpand can be used for a `simd<T>` of \p N elements.
+     */
+    template <typename T, int N>
+      constexpr bool have_x86_compress
+	= vectorizable<T> and std::has_single_bit(unsigned(N))
+	    and (sizeof(T) * N == 64 or sizeof(T) * N == 32 or sizeof(T) * N == 16)
+#ifndef __AVX512F__
+	    and false
+#endif
+#ifndef __AVX512VL__
+	    and sizeof(T) * N == 64
+#endif
+#ifndef __AVX512VBMI2__
+	    and sizeof(T) >= 4
+#endif
+	;
+
+    /* Number of elements compress_store/expand_load process at once via compress_lut/expand_lut
+     * (tables of 2^C rows) and one vector shuffle.
+     */
+    template <typename T, int N>
+      constexpr int lut_chunk_size = std::min({N, 8, int(32 / sizeof(T))});
+
+    /* Whether compress_store/expand_load can use permutes from compress_lut/expand_lut.
+     */
+    template <typename T, int N>
+      constexpr bool have_lut_compress
+	= vectorizable<T> and N >= 2 and N <= 64 and std::has_single_bit(unsigned(N))
+	    and sizeof(T) <= 8;
+
+    template <typename T>
+      using x86_compress_value_type
+	= std::conditional_t<std::is_floating_point_v<T>, T,
+			     std::conditional_t<sizeof(T) == 1, char, sized_int_t<sizeof(T)>>>;
+
+#define VIR_X86_COMPRESS_EXPAND(type, bytes, sfx, ufx)                                       \
+	else if constexpr (std::is_same_v<F, type> and Bytes == bytes)                       \
+	  {                                                                                  \
+	    if constexpr (Compress)                                                          \
+	      __builtin_ia32_compressstore##ufx##sfx##_mask(p, x, bits);                     \
+	    else                                                                             \
+	      return vir::detail::bit_cast<V>(                                               \
+		       __builtin_ia32_expandload##sfx##_maskz(p, Vec(), bits));              \
+	  }
+
+    /* Compress-store \p v to \p ptr or expand-load from \p ptr (depending on \p Compress) using
+     * AVX-512 vcompress/vexpand with the selection \p bits.
+     */
+    template <bool Compress, typename V, typename T>
+      VIR_ALWAYS_INLINE V
+      x86_compress_expand(const V& v, unsigned long long bits, T* ptr)
+      {
+	using F = x86_compress_value_type<typename V::value_type>;
+	constexpr int Bytes = sizeof(V);
+	using Vec [[gnu::vector_size(Bytes)]] = F;
+	[[maybe_unused]] const Vec x = vir::detail::bit_cast<Vec>(v);
+	auto* p = [ptr] {
+	  if constexpr (Compress)
+	    return reinterpret_cast<Vec*>(ptr);
+	  else
+	    return reinterpret_cast<const Vec*>(ptr);
+	}();
+	if constexpr (false)
+	  {}
+	VIR_X86_COMPRESS_EXPAND(float, 64, sf512, )
+	VIR_X86_COMPRESS_EXPAND(float, 32, sf256, )
+	VIR_X86_COMPRESS_EXPAND(float, 16, sf128, )
+	VIR_X86_COMPRESS_EXPAND(double, 64, df512, )
+	VIR_X86_COMPRESS_EXPAND(double, 32, df256, )
+	VIR_X86_COMPRESS_EXPAND(double, 16, df128, )
+	VIR_X86_COMPRESS_EXPAND(int, 64, si512, )
+	VIR_X86_COMPRESS_EXPAND(int, 32, si256, )
+	VIR_X86_COMPRESS_EXPAND(int, 16, si128, )
+	VIR_X86_COMPRESS_EXPAND(long long, 64, di512, )
+	VIR_X86_COMPRESS_EXPAND(long long, 32, di256, )
+	VIR_X86_COMPRESS_EXPAND(long long, 16, di128, )
+	VIR_X86_COMPRESS_EXPAND(short, 64, hi512, u)
+	VIR_X86_COMPRESS_EXPAND(short, 32, hi256, u)
+	VIR_X86_COMPRESS_EXPAND(short, 16, hi128, u)
+	VIR_X86_COMPRESS_EXPAND(char, 64, qi512, u)
+	VIR_X86_COMPRESS_EXPAND(char, 32, qi256, u)
+	VIR_X86_COMPRESS_EXPAND(char, 16, qi128, u)
+	return v;
+      }
+
+#undef VIR_X86_COMPRESS_EXPAND
+
+    /* Store the first \p n elements of \p v to \p ptr (Store) or load \p n elements from \p ptr
+     * into the low elements of \p v (!Store) using AVX vmaskmov.
+     */
+    template <bool Store, typename Vec, typename T>
+      VIR_ALWAYS_INLINE void
+      x86_partial_load_store(Vec& v, int n, T* ptr)
+      {
+	constexpr int N = sizeof(Vec) / sizeof(T);
+	using F = std::conditional_t<sizeof(T) == 4, float, double>;
+	using FVec [[gnu::vector_size(sizeof(Vec))]] = F;
+	using IVec [[gnu::vector_size(sizeof(Vec))]] = sized_int_t<sizeof(T)>;
+	const IVec mask = [&]<int... Is>(std::integer_sequence<int, Is...>) {
+	  return vir::detail::bit_cast<IVec>(IVec{Is...} < n);
+	}(std::make_integer_sequence<int, N>());
+	if constexpr (Store)
+	  {
+	    FVec* p = reinterpret_cast<FVec*>(ptr);
+	    const FVec x = vir::detail::bit_cast<FVec>(v);
+	    if constexpr (sizeof(Vec) == 32 and sizeof(T) == 4)
+	      __builtin_ia32_maskstoreps256(p, mask, x);
+	    else if constexpr (sizeof(Vec) == 32)
+	      __builtin_ia32_maskstorepd256(p, mask, x);
+	    else if constexpr (sizeof(T) == 4)
+	      __builtin_ia32_maskstoreps(p, mask, x);
+	    else
+	      __builtin_ia32_maskstorepd(p, mask, x);
+	  }
+	else
+	  {
+	    const FVec* p = reinterpret_cast<const FVec*>(ptr);
+	    FVec x;
+	    if constexpr (sizeof(Vec) == 32 and sizeof(T) == 4)
+	      x = __builtin_ia32_maskloadps256(p, mask);
+	    else if constexpr (sizeof(Vec) == 32)
+	      x = __builtin_ia32_maskloadpd256(p, mask);
+	    else if constexpr (sizeof(T) == 4)
+	      x = __builtin_ia32_maskloadps(p, mask);
+	    else
+	      x = __builtin_ia32_maskloadpd(p, mask);
+	    v = vir::detail::bit_cast<Vec>(x);
+	  }
+      }
+
+    /* Compress-store or expand-load using shuffles from compress_lut/expand_lut, processing
+     * chunks of lut_chunk_size elements. Only the first popcount(bits) elements at \p ptr are
+     * accessed.
+     */
+    template <bool Compress, typename V, typename T>
+      VIR_ALWAYS_INLINE V
+      lut_compress_expand(const V& v, unsigned long long bits, T* ptr)
+      {
+	using U = typename V::value_type;
+	constexpr int C = lut_chunk_size<U, V::size()>;
+	using Vec [[gnu::vector_size(sizeof(U) * C)]] = U;
+	using IVec [[gnu::vector_size(sizeof(U) * C)]] = sized_int_t<sizeof(U)>;
+	using Row [[gnu::vector_size(C)]] = unsigned char;
+	Vec chunks[V::size() / C];
+	std::memcpy(chunks, &v, sizeof(V));
+	for (Vec& x : chunks)
+	  {
+	    const unsigned chunk_bits = bits & ((1u << C) - 1);
+	    bits >>= C;
+	    const int n = std::popcount(chunk_bits);
+	    Row row;
+	    std::memcpy(&row, (Compress ? compress_lut<C> : expand_lut<C>)[chunk_bits].data(), C);
+	    const IVec idx = __builtin_convertvector(row, IVec);
+	    if constexpr (not Compress)
+	      {
+		x = Vec();
+#ifdef __AVX__
+		if constexpr ((sizeof(U) == 4 or sizeof(U) == 8) and sizeof(Vec) >= 16)
+		  x86_partial_load_store<false>(x, n, ptr);
+		else
+#endif
+		  for (int i = 0; i < n; ++i)
+		    x[i] = ptr[i];
+	      }
+	    x = __builtin_shuffle(x, idx);
+	    if constexpr (Compress)
+	      {
+#ifdef __AVX__
+		if constexpr ((sizeof(U) == 4 or sizeof(U) == 8) and sizeof(Vec) >= 16)
+		  x86_partial_load_store<true>(x, n, ptr);
+		else
+#endif
+		  for (int i = 0; i < n; ++i)
+		    ptr[i] = x[i];
+	      }
+	    ptr += n;
+	  }
+	V r = v;
+	if constexpr (not Compress)
+	  std::memcpy(&r, chunks, sizeof(V));
+	return r;
+      }
+#endif // __GNUC__
+  }
+
+  /** \brief Stores the elements of the `simd` object in \p w where the mask in \p w is `true`
+   * contiguously to \p ptr.
+   *
+   * \returns The number of stored elements (`popcount(mask)`).
+   *
+   * Only the first `popcount(mask)` elements at \p ptr are written. Example:
+   * \code
+   * out += vir::compress_store(stdx::where(x > 0, x), out);
+   * \endcode
+   */
+  template <typename M, any_simd V, vectorizable T>
+    requires std::same_as<M, typename V::mask_type>
+    VIR_ALWAYS_INLINE constexpr int
+    compress_store(const stdx::const_where_expression<M, V>& w, T* ptr)
+    {
+      using U = typename V::value_type;
+      constexpr int N = V::size();
+      const M& k = detail::where_mask(w);
+      const V& v = detail::where_value(w);
+#if defined __GNUC__ and not defined __clang__
+      if (not std::is_constant_evaluated())
+	if constexpr (std::is_same_v<T, U> and sizeof(V) == sizeof(U) * N
+			and std::is_trivially_copyable_v<V>)
+	  {
+	    const auto bits = detail::mask_to_bits(k);
+	    if constexpr (detail::have_x86_compress<U, N>)
+	      {
+		detail::x86_compress_expand<true>(v, bits, ptr);
+		return std::popcount(bits);
+	      }
+	    else if constexpr (detail::have_lut_compress<U, N>)
+	      {
+		detail::lut_compress_expand<true>(v, bits, ptr);
+		return std::popcount(bits);
+	      }
+	  }
+#endif
+      int n = 0;
+      for (std::size_t i = 0; i < V::size(); ++i)
+	if (k[i])
+	  ptr[n++] = static_cast<T>(v[i]);
+      return n;
+    }
+
+  /** \brief Loads `popcount(k)` elements from \p ptr into the elements where \p k is `true`
+   * (in order); all other elements are zero.
+   *
+   * This is the inverse of compress_store. Only the first `popcount(k)` elements at \p ptr are
+   * read.
+   *
+   * \tparam V  The return type. Defaults to a simd with value type \p T and the same width and
+   *            ABI as \p k.
+   */
+  template <typename V = void, any_simd_mask M, vectorizable T,
+	    typename R = std::conditional_t<std::is_void_v<V>,
+					    stdx::rebind_simd_t<T, typename M::simd_type>, V>>
+    requires any_simd<R> and (R::size() == M::size())
+    VIR_ALWAYS_INLINE constexpr R
+    expand_load(const M& k, const T* ptr)
+    {
+      using U = typename R::value_type;
+      constexpr int N = R::size();
+#if defined __GNUC__ and not defined __clang__
+      if (not std::is_constant_evaluated())
+	if constexpr (std::is_same_v<T, U> and sizeof(R) == sizeof(U) * N
+			and std::is_trivially_copyable_v<R>)
+	  {
+	    const auto bits = detail::mask_to_bits(k);
+	    if constexpr (detail::have_x86_compress<U, N>)
+	      return detail::x86_compress_expand<false>(R(), bits, ptr);
+	    else if constexpr (detail::have_lut_compress<U, N>)
+	      return detail::lut_compress_expand<false>(R(), bits, ptr);
+	  }
+#endif
+      std::array<U, N> tmp = {};
+      for (int i = 0, j = 0; i < N; ++i)
+	if (k[i])
+	  tmp[i] = static_cast<U>(ptr[j++]);
+      return R([&](auto i) { return tmp[i]; });
+    }
 }
 
 #endif // has concepts
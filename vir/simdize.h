@@ -95,6 +95,100 @@ namespace vir
 	  return __builtin_shufflevector(a, b, (selected(Is) ? Is + N : Is)...);
 	}(std::make_integer_sequence<int, N>());
       }
+
+    /** \internal
+     * Layout of one data member in an array of structs, counted in elements of the deinterleaving
+     * vectors: every struct occupies `stride` elements and the member occupies the `size` elements
+     * starting at `offset`.
+     */
+    struct member_layout
+    {
+      int stride, offset, size;
+
+      /// The index into the interleaved array for element \p u of the deinterleaved member.
+      constexpr int
+      source(int u) const
+      { return u / size * stride + offset + u % size; }
+    };
+
+    /** \internal
+     * The number of input chunks of \p W elements in [\p lo, \p hi) that hold at least one
+     * element of the member described by \p L.
+     */
+    template <member_layout L, int W>
+      constexpr int
+      deinterleave_chunk_count(int lo, int hi)
+      {
+	int n = 0;
+	for (int c = lo; c < hi; ++c)
+	  for (int u = 0; u < W; ++u)
+	    if (L.source(u) / W == c)
+	      {
+		++n;
+		break;
+	      }
+	return n;
+      }
+
+    /** \internal
+     * Combines the chunks x[Lo] ... x[Hi - 1] with a binary tree of two-input shuffles such that
+     * every element of the member described by \p L that resides in one of these chunks is moved
+     * to its final position. Subtrees without any such element are pruned; a subtree with only a
+     * single such chunk returns that chunk unmodified.
+     */
+    template <member_layout L, int Lo, int Hi, typename V>
+      VIR_ALWAYS_INLINE V
+      deinterleave_tree(const V* x)
+      {
+	constexpr int W = sizeof(V) / sizeof(x[0][0]);
+	if constexpr (Hi - Lo == 1)
+	  return x[Lo];
+	else
+	  {
+	    constexpr int Mid = (Lo + Hi) / 2;
+	    constexpr int n_lo = deinterleave_chunk_count<L, W>(Lo, Mid);
+	    constexpr int n_hi = deinterleave_chunk_count<L, W>(Mid, Hi);
+	    if constexpr (n_hi == 0)
+	      return deinterleave_tree<L, Lo, Mid>(x);
+	    else if constexpr (n_lo == 0)
+	      return deinterleave_tree<L, Mid, Hi>(x);
+	    else
+	      {
+		constexpr auto idx = [](int u) {
+		  const int c = L.source(u) / W;
+		  const int e = L.source(u) % W;
+		  if (c < Lo or c >= Hi)
+		    return -1;
+		  else if (c < Mid)
+		    return n_lo == 1 ? e : u;
+		  else
+		    return W + (n_hi == 1 ? e : u);
+		};
+		return [&]<int... Us>(std::integer_sequence<int, Us...>) {
+		  return __builtin_shufflevector(deinterleave_tree<L, Lo, Mid>(x),
+						 deinterleave_tree<L, Mid, Hi>(x), idx(Us)...);
+		}(std::make_integer_sequence<int, W>());
+	      }
+	  }
+      }
+
+    /** \internal
+     * Returns the member described by \p L from the \p Chunks vectors \p x, which hold an array
+     * of structs.
+     */
+    template <member_layout L, int Chunks, typename V>
+      VIR_ALWAYS_INLINE V
+      deinterleave(const V* x)
+      {
+	constexpr int W = sizeof(V) / sizeof(x[0][0]);
+	if constexpr (deinterleave_chunk_count<L, W>(0, Chunks) == 1)
+	  return [&]<int... Us>(std::integer_sequence<int, Us...>) {
+	    constexpr int c = L.source(0) / W;
+	    return __builtin_shufflevector(x[c], x[c], (L.source(Us) % W)...);
+	  }(std::make_integer_sequence<int, W>());
+	else
+	  return deinterleave_tree<L, 0, Chunks>(x);
+      }
 #endif
 
     template <typename T, int N>
@@ -290,10 +384,12 @@ namespace vir
 	  {
 	    static_assert(flat_member_count_v<TT> > struct_size_v<TT>);
 	    constexpr auto size = flat_member_count_v<struct_element_t<Offset, TT>>;
-	    if constexpr (I < size)
+	    if constexpr (I < size and reflectable_struct<struct_element_t<Offset, TT>>)
 	      return flat_get<I>(vir::struct_get<Offset>(s));
+	    else if constexpr (I < size)
+	      return vir::struct_get<Offset>(s);
 	    else
-	      return flat_get<I - size, size>(s);
+	      return flat_get<I - size, Offset + 1>(s);
 	  }
       }
 
@@ -359,6 +455,63 @@ namespace vir
       { using type = vectorized_struct<T, N == 0 ? default_simdize_size_v<T> : N>; };
   } // namespace detail
 
+  /**
+   * \brief Opt-in for member-wise operators on `vir::simdize<T, N>`.
+   *
+   * Specialize as `true` for a struct (template) \p T to enable `+`, `-`, `*`, `/` (and their
+   * compound assignments) and the comparison operators on simd_tuple and vectorized_struct. The
+   * arithmetic operators apply to every (flat) data member. `==`, `<`, `<=`, `>`, and `>=`
+   * return the conjunction of the member-wise comparisons as `mask_type`; `!=` is the negation
+   * of `==`. If the struct template already defines an operator for its simdized type,
+   * vectorized_struct continues to use that definition instead.
+   *
+   * \code
+   * template <typename T>
+   *   inline constexpr bool vir::enable_simdize_operators<Vec3<T>> = true;
+   * \endcode
+   */
+  template <typename T>
+    inline constexpr bool enable_simdize_operators = false;
+
+  namespace detail
+  {
+    /// Converts between masks of equal size but different value type.
+    template <typename M, typename M2>
+      VIR_ALWAYS_INLINE constexpr M
+      mask_cast(const M2& k)
+      {
+	if constexpr (std::same_as<M, M2>)
+	  return k;
+	else
+	  return stdx::static_simd_cast<M>(k);
+      }
+
+    /** \internal
+     * Returns \p a with every flat data member replaced by `op(member of a, member of b)`.
+     */
+    template <int Count, typename V, typename Op>
+      VIR_ALWAYS_INLINE constexpr V
+      memberwise(V a, const V& b, Op op)
+      {
+	[&]<int... Is>(std::integer_sequence<int, Is...>) {
+	  ((flat_get<Is>(a) = op(flat_get<Is>(a), flat_get<Is>(b))), ...);
+	}(std::make_integer_sequence<int, Count>());
+	return a;
+      }
+
+    /** \internal
+     * Returns the conjunction of `cmp(member of a, member of b)` over all flat data members.
+     */
+    template <int Count, typename M, typename V, typename Cmp>
+      VIR_ALWAYS_INLINE constexpr M
+      memberwise_conjunction(const V& a, const V& b, Cmp cmp)
+      {
+	return [&]<int... Is>(std::integer_sequence<int, Is...>) {
+	  return (mask_cast<M>(cmp(flat_get<Is>(a), flat_get<Is>(b))) && ...);
+	}(std::make_integer_sequence<int, Count>());
+      }
+  } // namespace detail
+
   /**
    * \brief `simd`-like interface for tuples of vectorized data members of \p T.
    *
@@ -374,6 +527,31 @@ namespace vir
 
       static constexpr auto tuple_size_idx_seq = std::make_index_sequence<vir::struct_size_v<T>>();
 
+      /** \internal
+       * True if every member of T is vectorized as a `simd` of the same element size that fits
+       * into a single native register and T has no padding. Then N consecutive T objects are
+       * exactly struct_size_v<T> such registers in memory.
+       */
+      static constexpr bool _has_interleavable_members = [] {
+	if constexpr (std::is_aggregate_v<T> and std::is_standard_layout_v<T>
+			and std::is_trivially_copyable_v<T>)
+	  return []<std::size_t... Is>(std::index_sequence<Is...>) {
+	    if constexpr ((stdx::is_simd_v<std::tuple_element_t<Is, tuple_type>> and ...))
+	      {
+		using U0 = typename std::tuple_element_t<0, tuple_type>::value_type;
+		constexpr std::size_t size0 = sizeof(U0);
+		return sizeof(T) == sizeof...(Is) * size0
+			 and N <= stdx::native_simd<U0>::size()
+			 and ((sizeof(vir::struct_element_t<Is, T>) == size0) and ...)
+			 and ((sizeof(std::tuple_element_t<Is, tuple_type>) == size0 * N) and ...);
+	      }
+	    else
+	      return false;
+	  }(tuple_size_idx_seq);
+	else
+	  return false;
+      }();
+
     public:
       /// The element type of this `simd`-like type.
       using value_type = T;
@@ -387,6 +565,8 @@ namespace vir
       template <typename U = T>
 	inline static constexpr std::size_t memory_alignment = alignof(U);
 
+      simd_tuple() = default;
+
       template <typename... Ts>
 	requires (sizeof...(Ts) == std::tuple_size_v<tuple_type>
 		    and detail::test_all_of<std::is_constructible, std::tuple_element, tuple_type,
@@ -488,9 +668,120 @@ namespace vir
 	constexpr void
 	copy_to(It it, Flags = {}) const
 	{
-	  for (std::size_t i = 0; i < size(); ++i)
-	    it[i] = operator[](i);
+	  if constexpr (std::same_as<std::iter_value_t<It>, T>)
+	    _store_elements_via_permute(std::to_address(it), std::make_integer_sequence<int, N>());
+	  else
+	    for (std::size_t i = 0; i < size(); ++i)
+	      it[i] = operator[](i);
+	}
+
+      template <int... Is>
+	VIR_ALWAYS_INLINE constexpr void
+	_store_elements_via_permute(T* addr, std::integer_sequence<int, Is...>) const
+	{
+#if VIR_HAVE_WORKING_SHUFFLEVECTOR
+	  if (not std::is_constant_evaluated())
+	    if constexpr (N > 1 and std::has_single_bit(unsigned(N)) and _has_interleavable_members
+			    and struct_size_v<T> <= 4)
+	      {
+		using U = typename std::tuple_element_t<0, tuple_type>::value_type;
+		using V [[gnu::vector_size(sizeof(U) * N)]] = U;
+		std::byte* byte_ptr = reinterpret_cast<std::byte*>(addr);
+		const auto store = [&](int k, const V& x) {
+		  std::memcpy(byte_ptr + k * sizeof(V), &x, sizeof(V));
+		};
+		// members of different type but equal size are permuted as U
+		const V a = std::bit_cast<V>(std::get<0>(elements));
+		const V b = std::bit_cast<V>(std::get<1>(elements));
+		if constexpr (struct_size_v<T> == 2)
+		  {
+		    // [a0 b0 a1 b1 ...] [a(N/2) b(N/2) ...]
+		    store(0, __builtin_shufflevector(a, b, (Is % 2 * N + Is / 2)...));
+		    store(1, __builtin_shufflevector(a, b, (Is % 2 * N + (N + Is) / 2)...));
+		  }
+		else if constexpr (struct_size_v<T> == 3)
+		  {
+		    const V c = std::bit_cast<V>(std::get<2>(elements));
+		    // For output element p: interleave a and b, keep the slots for c arbitrary
+		    constexpr auto ab = [](int p) {
+		      return p % 3 == 0 ? p / 3 : p % 3 == 1 ? N + p / 3 : p % N;
+		    };
+		    // then fill in the c slots
+		    constexpr auto abc = [](int p) { return p % 3 == 2 ? N + p / 3 : p % N; };
+		    // [a0 b0 c0 a1 ...] [... c(N/3*2)] ...
+		    store(0, __builtin_shufflevector(__builtin_shufflevector(a, b, ab(Is)...), c,
+						     abc(Is)...));
+		    store(1, __builtin_shufflevector(__builtin_shufflevector(a, b, ab(N + Is)...), c,
+						     abc(N + Is)...));
+		    store(2, __builtin_shufflevector(__builtin_shufflevector(a, b, ab(2 * N + Is)...),
+						     c, abc(2 * N + Is)...));
+		  }
+		else
+		  {
+		    const V c = std::bit_cast<V>(std::get<2>(elements));
+		    const V d = std::bit_cast<V>(std::get<3>(elements));
+		    // [a0 c0 a1 c1 ...] [a(N/2) c(N/2) ...]
+		    const V ac0 = __builtin_shufflevector(a, c, (Is % 2 * N + Is / 2)...);
+		    const V ac1 = __builtin_shufflevector(a, c, (Is % 2 * N + (N + Is) / 2)...);
+		    // [b0 d0 b1 d1 ...] [b(N/2) d(N/2) ...]
+		    const V bd0 = __builtin_shufflevector(b, d, (Is % 2 * N + Is / 2)...);
+		    const V bd1 = __builtin_shufflevector(b, d, (Is % 2 * N + (N + Is) / 2)...);
+		    // [a0 b0 c0 d0 a1 ...] ...
+		    store(0, __builtin_shufflevector(ac0, bd0, (Is % 2 * N + Is / 2)...));
+		    store(1, __builtin_shufflevector(ac0, bd0, (Is % 2 * N + (N + Is) / 2)...));
+		    store(2, __builtin_shufflevector(ac1, bd1, (Is % 2 * N + Is / 2)...));
+		    store(3, __builtin_shufflevector(ac1, bd1, (Is % 2 * N + (N + Is) / 2)...));
+		  }
+		return;
+	      }
+#endif
+	  // strided stores of every member
+	  [&]<std::size_t... Js>(std::index_sequence<Js...>) {
+	    for (int i = 0; i < N; ++i)
+	      ((vir::struct_get<Js>(addr[i]) = std::get<Js>(elements)[i]), ...);
+	  }(tuple_size_idx_seq);
 	}
+
+      // Member-wise operators if enabled via enable_simdize_operators.
+#define VIR_MEMBERWISE_OPERATOR(op)                                                                \
+      VIR_ALWAYS_INLINE friend constexpr simd_tuple                                                \
+      operator op(simd_tuple const& a, simd_tuple const& b)                                        \
+      requires enable_simdize_operators<T>                                                         \
+      {                                                                                            \
+	return detail::memberwise<detail::flat_member_count_v<T>>(                                 \
+		 a, b, [](const auto& x, const auto& y) { return x op y; });                       \
+      }                                                                                            \
+                                                                                                   \
+      VIR_ALWAYS_INLINE friend constexpr simd_tuple&                                               \
+      operator op##=(simd_tuple& a, simd_tuple const& b)                                           \
+      requires enable_simdize_operators<T>                                                         \
+      { return a = a op b; }
+
+#define VIR_MEMBERWISE_COMPARISON(op)                                                              \
+      VIR_ALWAYS_INLINE friend constexpr mask_type                                                 \
+      operator op(simd_tuple const& a, simd_tuple const& b)                                        \
+      requires enable_simdize_operators<T>                                                         \
+      {                                                                                            \
+	return detail::memberwise_conjunction<detail::flat_member_count_v<T>, mask_type>(          \
+		 a, b, [](const auto& x, const auto& y) { return x op y; });                       \
+      }
+
+      VIR_MEMBERWISE_OPERATOR(+)
+      VIR_MEMBERWISE_OPERATOR(-)
+      VIR_MEMBERWISE_OPERATOR(*)
+      VIR_MEMBERWISE_OPERATOR(/)
+      VIR_MEMBERWISE_COMPARISON(==)
+      VIR_MEMBERWISE_COMPARISON(>=)
+      VIR_MEMBERWISE_COMPARISON(>)
+      VIR_MEMBERWISE_COMPARISON(<=)
+      VIR_MEMBERWISE_COMPARISON(<)
+#undef VIR_MEMBERWISE_COMPARISON
+#undef VIR_MEMBERWISE_OPERATOR
+
+      VIR_ALWAYS_INLINE friend constexpr mask_type
+      operator!=(simd_tuple const& a, simd_tuple const& b)
+      requires enable_simdize_operators<T>
+      { return !(a == b); }
     };
 
   /**
@@ -533,6 +824,105 @@ namespace vir
       _as_base_type() const
       { return *this; }
 
+      /** \internal
+       * True if the general deinterleaving load applies: 2 to 8 flat data members of power-of-two
+       * size, each vectorized into a single native register, and no padding in T.
+       */
+      static constexpr bool _deinterleavable = [] {
+	if constexpr (N < 2 or not std::has_single_bit(unsigned(N)) or _flat_member_count < 2
+			or _flat_member_count > 8)
+	  return false;
+	else
+	  return []<int... Is>(std::integer_sequence<int, Is...>) {
+	    return (sizeof(detail::flat_element_t<Is, T>) + ...) == sizeof(T)
+		     and ((std::has_single_bit(sizeof(detail::flat_element_t<Is, T>))
+			     and sizeof(detail::flat_element_t<Is, tuple_type>)
+				   == N * sizeof(detail::flat_element_t<Is, T>)
+			     and N <= stdx::native_simd<typename detail::flat_element_t<
+					Is, tuple_type>::value_type>::size()) and ...);
+	  }(std::make_integer_sequence<int, _flat_member_count>());
+      }();
+
+      /** \internal
+       * Byte offsets of the flat data members if T has no padding and stores its flat data
+       * members in declaration order, or in reverse order if \p Reversed (libstdc++'s std::tuple).
+       */
+      template <bool Reversed>
+	static constexpr auto _packed_flat_member_offsets
+	  = []<int... Is>(std::integer_sequence<int, Is...>) {
+	      constexpr std::array<int, _flat_member_count> sizes
+		= {int(sizeof(detail::flat_element_t<Is, T>))...};
+	      std::array<int, _flat_member_count> offsets = {};
+	      int offset = 0;
+	      for (int i = 0; i < _flat_member_count; ++i)
+		{
+		  const int j = Reversed ? _flat_member_count - 1 - i : i;
+		  offsets[j] = offset;
+		  offset += sizes[j];
+		}
+	      return offsets;
+	    }(std::make_integer_sequence<int, _flat_member_count>());
+
+      /** \internal
+       * Tests whether the flat data members of \p addr[0] are at \ref _packed_flat_member_offsets.
+       * The compiler folds this to a constant.
+       */
+      template <bool Reversed>
+	VIR_ALWAYS_INLINE static bool
+	_has_packed_flat_members(const T* addr)
+	{
+	  const std::byte* byte_ptr = reinterpret_cast<const std::byte*>(addr);
+	  return [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+	    return ((reinterpret_cast<const std::byte*>(std::addressof(detail::flat_get<Is>(*addr)))
+		       == byte_ptr + _packed_flat_member_offsets<Reversed>[Is]) and ...);
+	  }(_flat_member_idx_seq);
+	}
+
+#if VIR_HAVE_WORKING_SHUFFLEVECTOR
+      /** \internal
+       * Loads N objects of type T from \p byte_ptr and deinterleaves them into flat member \p I,
+       * using a compile-time generated shuffle network. Members larger than the smallest member
+       * are handled as several consecutive elements of the smallest size.
+       */
+      template <int I, bool Reversed>
+	VIR_ALWAYS_INLINE static detail::flat_element_t<I, tuple_type>
+	_deinterleave_flat_member(const std::byte* byte_ptr)
+	{
+	  constexpr int unit = [&]<int... Is>(std::integer_sequence<int, Is...>) {
+	    return std::min({int(sizeof(detail::flat_element_t<Is, T>))...});
+	  }(std::make_integer_sequence<int, _flat_member_count>());
+	  constexpr int size = sizeof(detail::flat_element_t<I, T>) / unit;
+	  constexpr int chunks = sizeof(T) / (size * unit);
+	  using V [[gnu::vector_size(N * size * unit)]] = detail::sized_int_t<unit>;
+	  constexpr detail::member_layout layout {
+	    sizeof(T) / unit, _packed_flat_member_offsets<Reversed>[I] / unit, size};
+	  V x[chunks];
+	  std::memcpy(x, byte_ptr, sizeof(x));
+	  return std::bit_cast<detail::flat_element_t<I, tuple_type>>(
+		   detail::deinterleave<layout, chunks>(x));
+	}
+
+      template <bool Reversed>
+	VIR_ALWAYS_INLINE static base_type
+	_load_elements_via_deinterleave(const T* addr)
+	{
+	  const std::byte* byte_ptr = reinterpret_cast<const std::byte*>(addr);
+	  return [&]<int... Is>(std::integer_sequence<int, Is...>) {
+	    return base_type {_deinterleave_flat_member<Is, Reversed>(byte_ptr)...};
+	  }(std::make_integer_sequence<int, _flat_member_count>());
+	}
+#endif
+
+      VIR_ALWAYS_INLINE static constexpr base_type
+      _load_elements_member_wise(const T* addr)
+      {
+	return [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+	  return base_type {detail::flat_element_t<Is, tuple_type>([&](size_t i) {
+			      return detail::flat_get<Is>(addr[i]);
+			    })...};
+	}(_flat_member_idx_seq);
+      }
+
     public:
       using value_type = T;
       using mask_type = typename detail::flat_element_t<0, base_type>::mask_type;
@@ -586,6 +976,14 @@ namespace vir
 			  and std::has_single_bit(unsigned(N)))
 	    {
 	      const std::byte* byte_ptr = reinterpret_cast<const std::byte*>(addr);
+	      // the following assumes flat data members in declaration order
+	      if (not _has_packed_flat_members<false>(addr))
+		{
+		  if constexpr (_deinterleavable)
+		    if (_has_packed_flat_members<true>(addr))
+		      return _load_elements_via_deinterleave<true>(addr);
+		  return _load_elements_member_wise(addr);
+		}
 	      // struct_size_v == 2 doesn't need anything, the fallback works fine, unless
 	      // we allow unordered access
 	      using V0 = detail::flat_element_t<0, tuple_type>;
@@ -800,15 +1198,13 @@ namespace vir
 			     }(std::make_integer_sequence<int, N>());
 		    }
 		}
+	      if constexpr (_deinterleavable)
+		return _load_elements_via_deinterleave<false>(addr);
 	    }
 #endif // VIR_HAVE_WORKING_SHUFFLEVECTOR
 
 	// not optimized fallback
-	return [&]<std::size_t... Is>(std::index_sequence<Is...>) {
-	  return base_type {detail::flat_element_t<Is, tuple_type>([&](size_t i) {
-			      return detail::flat_get<Is>(addr[i]);
-			    })...};
-	}(_flat_member_idx_seq);
+	return _load_elements_member_wise(addr);
       }
 
       template <int... Is>
@@ -895,8 +1291,9 @@ namespace vir
 		  }
 	      }
 #endif
-	  for (int i = 0; i < N; ++i)
-	    addr[i] = operator[](i);
+	  // Unrolled over constant indexes: GCC 12 miscompiles the equivalent runtime-index loop
+	  // (the call containing the stores can be found 'const' and eliminated).
+	  ((addr[Is] = operator[](Is)), ...);
 	}
 
       /**
@@ -976,6 +1373,48 @@ namespace vir
       VIR_OPERATOR_FWD(<=)
       VIR_OPERATOR_FWD(<)
 #undef VIR_OPERATOR_FWD
+
+      // Member-wise operators if enabled via enable_simdize_operators and not already defined by
+      // the struct template.
+#define VIR_MEMBERWISE_OPERATOR(op)                                                                \
+      VIR_ALWAYS_INLINE friend constexpr vectorized_struct                                         \
+      operator op(vectorized_struct const& a, vectorized_struct const& b)                          \
+      requires enable_simdize_operators<T> and (not requires(base_type const& x) { {x op x}; })   \
+      {                                                                                            \
+	return detail::memberwise<_flat_member_count>(                                             \
+		 a, b, [](const auto& x, const auto& y) { return x op y; });                       \
+      }                                                                                            \
+                                                                                                   \
+      VIR_ALWAYS_INLINE friend constexpr vectorized_struct&                                        \
+      operator op##=(vectorized_struct& a, vectorized_struct const& b)                             \
+      requires enable_simdize_operators<T> and (not requires(base_type const& x) { {x op x}; })   \
+      { return a = a op b; }
+
+#define VIR_MEMBERWISE_COMPARISON(op)                                                              \
+      VIR_ALWAYS_INLINE friend constexpr mask_type                                                 \
+      operator op(vectorized_struct const& a, vectorized_struct const& b)                          \
+      requires enable_simdize_operators<T> and (not requires(base_type const& x) { {x op x}; })   \
+      {                                                                                            \
+	return detail::memberwise_conjunction<_flat_member_count, mask_type>(                      \
+		 a, b, [](const auto& x, const auto& y) { return x op y; });                       \
+      }
+
+      VIR_MEMBERWISE_OPERATOR(+)
+      VIR_MEMBERWISE_OPERATOR(-)
+      VIR_MEMBERWISE_OPERATOR(*)
+      VIR_MEMBERWISE_OPERATOR(/)
+      VIR_MEMBERWISE_COMPARISON(==)
+      VIR_MEMBERWISE_COMPARISON(>=)
+      VIR_MEMBERWISE_COMPARISON(>)
+      VIR_MEMBERWISE_COMPARISON(<=)
+      VIR_MEMBERWISE_COMPARISON(<)
+#undef VIR_MEMBERWISE_COMPARISON
+#undef VIR_MEMBERWISE_OPERATOR
+
+      VIR_ALWAYS_INLINE friend constexpr mask_type
+      operator!=(vectorized_struct const& a, vectorized_struct const& b)
+      requires enable_simdize_operators<T> and (not requires(base_type const& x) { {x != x}; })
+      { return !(a == b); }
     };
 
   /**
@@ -999,6 +1438,104 @@ namespace vir
 	       static_cast<detail::simdize_template_arguments_t<T, N>&>(tup));
     }
 
+  namespace detail
+  {
+    template <typename V>
+      struct is_simdized_struct
+      : std::false_type
+      {};
+
+    template <typename T, int N>
+      struct is_simdized_struct<simd_tuple<T, N>>
+      : std::true_type
+      {};
+
+    template <typename T, int N>
+      struct is_simdized_struct<vectorized_struct<T, N>>
+      : std::true_type
+      {};
+  } // namespace detail
+
+  /**
+   * \brief Masked assignment to the data members of a simd_tuple or vectorized_struct.
+   *
+   * \see vir::where
+   */
+  template <typename V>
+    class simdize_where_expression
+    {
+      using _mask_type = typename V::mask_type;
+
+      static constexpr int _flat_member_count
+	= detail::flat_member_count_v<typename V::value_type>;
+
+      const _mask_type _k;
+
+      V& _v;
+
+      /// Assigns `op(member of v, member of x)` to every flat member where the mask is true.
+      template <typename Op>
+	VIR_ALWAYS_INLINE constexpr void
+	_apply(const V& x, Op op) const
+	{
+	  [&]<int... Is>(std::integer_sequence<int, Is...>) {
+	    ((stdx::where(detail::mask_cast<typename std::remove_cvref_t<
+					      decltype(detail::flat_get<Is>(_v))>::mask_type>(_k),
+			  detail::flat_get<Is>(_v))
+		= op(detail::flat_get<Is>(_v), detail::flat_get<Is>(x))), ...);
+	  }(std::make_integer_sequence<int, _flat_member_count>());
+	}
+
+    public:
+      constexpr
+      simdize_where_expression(const _mask_type& k, V& v)
+      : _k(k), _v(v)
+      {}
+
+      VIR_ALWAYS_INLINE constexpr void
+      operator=(const V& x) &&
+      { _apply(x, [](const auto&, const auto& y) { return y; }); }
+
+#define VIR_MEMBERWISE_OPERATOR(op)                                                                \
+      VIR_ALWAYS_INLINE constexpr void                                                             \
+      operator op##=(const V& x) &&                                                                \
+      requires enable_simdize_operators<typename V::value_type>                                    \
+      { _apply(x, [](const auto& a, const auto& b) { return a op b; }); }
+
+      VIR_MEMBERWISE_OPERATOR(+)
+      VIR_MEMBERWISE_OPERATOR(-)
+      VIR_MEMBERWISE_OPERATOR(*)
+      VIR_MEMBERWISE_OPERATOR(/)
+#undef VIR_MEMBERWISE_OPERATOR
+    };
+
+  /**
+   * \brief Returns an object for masked assignment to all data members of \p v.
+   *
+   * `vir::where(k, v) = x` assigns the elements of `x` to `v` where `k` is `true`. The compound
+   * assignments `+=`, `-=`, `*=`, and `/=` are available if enable_simdize_operators is enabled
+   * for `V::value_type`.
+   */
+  template <typename V>
+    requires detail::is_simdized_struct<V>::value
+    constexpr simdize_where_expression<V>
+    where(const typename V::mask_type& k, V& v)
+    { return {k, v}; }
+
+  /**
+   * \brief Returns the elements of \p a where \p k is `true` and the elements of \p b
+   * otherwise.
+   */
+  template <typename V>
+    requires detail::is_simdized_struct<V>::value
+    VIR_ALWAYS_INLINE constexpr V
+    select(const typename V::mask_type& k, const V& a, const V& b)
+    {
+      V r = b;
+      vir::where(k, r) = a;
+      return r;
+    }
+
   /**
    * A type T is a vectorizable struct if the struct member types can recursively be reflected and
    * all leaf types satisfy vectorizable.
@@ -0,0 +1,591 @@
+/* SPDX-License-Identifier: LGPL-3.0-or-later */
+/* Copyright © 2024      GSI Helmholtzzentrum fuer Schwerionenforschung GmbH
+ *                       Matthias Kretz <m.kretz@gsi.de>
+ */
+
+#ifndef VIR_SOA_VECTOR_H_
+#define VIR_SOA_VECTOR_H_
+
+/** \file vir/soa_vector.h
+ * \brief A vector of structs that stores every data member in its own array (structure of
+ * arrays).
+ */
+
+#include "simdize.h"
+
+#if VIR_HAVE_SIMDIZE
+#define VIR_HAVE_SOA_VECTOR 1
+
+#include <algorithm>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <new>
+#include <span>
+#include <tuple>
+#include <utility>
+
+namespace vir
+{
+  namespace detail
+  {
+    /// The type of the \p I-th flat data member of \p T (also for structs nested in any member).
+    template <int I, typename T>
+      using soa_member_t = std::remove_cvref_t<decltype(flat_get<I>(std::declval<T&>()))>;
+
+    template <typename T, typename = std::make_integer_sequence<int, flat_member_count_v<T>>>
+      struct soa_pointers;
+
+    /// A tuple of pointers to the arrays of the flat data members of \p T.
+    template <typename T, int... Is>
+      struct soa_pointers<T, std::integer_sequence<int, Is...>>
+      { using type = std::tuple<soa_member_t<Is, T>*...>; };
+  } // namespace detail
+
+  /**
+   * \brief A sequence container for structs, storing every (flat) data member in its own array.
+   *
+   * Each of the arrays is aligned for vector loads and padded to a multiple of `simd_size`
+   * elements. `simd_at(i)` thus loads `vir::simdize<T>` with aligned vector loads and no
+   * permutations. The iterators of soa_vector load and store whole chunks, such that
+   * vir::for_each, vir::transform, and vir::transform_reduce with vir::execution::simd see the
+   * structure of arrays instead of a range of structs.
+   *
+   * Nested structs are flattened, i.e. `struct Particle { Vec3 pos; Vec3 vel; float m; }` is
+   * stored in seven arrays. `operator[]` returns a proxy object that converts to and is
+   * assignable from `T`. Reallocation invalidates all iterators and references.
+   *
+   * \tparam T A reflectable struct (see vir/struct_reflect.h) with vectorizable data members.
+   */
+  template <typename T>
+    requires vectorizable_struct<T> and std::default_initializable<T>
+               and requires { typename vir::simdize<T>; }
+    class soa_vector
+    {
+      static constexpr int _member_count = detail::flat_member_count_v<T>;
+
+      static constexpr auto _member_idx_seq = std::make_integer_sequence<int, _member_count>();
+
+      template <int I>
+        using _member_type = detail::soa_member_t<I, T>;
+
+    public:
+      using value_type = T;
+      using size_type = std::size_t;
+      using difference_type = std::ptrdiff_t;
+      using const_reference = T;
+
+      /// The `simd`-like type of the default width.
+      using simd_type = vir::simdize<T>;
+
+      /// The number of elements in `simd_type`. The capacity is always a multiple of simd_size.
+      static constexpr size_type simd_size = simd_type::size();
+
+      /// The alignment (in Bytes) of the member arrays.
+      static constexpr std::size_t alignment = [] {
+        return [&]<int... Is>(std::integer_sequence<int, Is...>) {
+          return std::max({alignof(_member_type<Is>)...,
+                           stdx::memory_alignment_v<detail::soa_member_t<Is, simd_type>>...});
+        }(_member_idx_seq);
+      }();
+
+    private:
+      typename detail::soa_pointers<T>::type _members = {};
+
+      size_type _size = 0;
+
+      size_type _capacity = 0;
+
+      /// Bytes of one member array, padded such that the next array is aligned.
+      template <int I>
+        static constexpr size_type
+        _array_bytes(size_type capacity)
+        { return (capacity * sizeof(_member_type<I>) + alignment - 1) / alignment * alignment; }
+
+      static constexpr size_type
+      _allocation_bytes(size_type capacity)
+      {
+        return [&]<int... Is>(std::integer_sequence<int, Is...>) {
+          return (_array_bytes<Is>(capacity) + ...);
+        }(_member_idx_seq);
+      }
+
+      void
+      _deallocate() noexcept
+      {
+        if (_capacity)
+          ::operator delete(static_cast<void*>(std::get<0>(_members)),
+                            _allocation_bytes(_capacity), std::align_val_t(alignment));
+      }
+
+      /// Replaces the storage by \p capacity zero-initialized elements and keeps the elements.
+      void
+      _reallocate(size_type capacity)
+      {
+        capacity = (capacity + simd_size - 1) / simd_size * simd_size;
+        const size_type bytes = _allocation_bytes(capacity);
+        std::byte* data = static_cast<std::byte*>(
+                            ::operator new(bytes, std::align_val_t(alignment)));
+        std::memset(data, 0, bytes);
+        decltype(_members) members;
+        [&]<int... Is>(std::integer_sequence<int, Is...>) {
+          size_type offset = 0;
+          ((std::get<Is>(members) = reinterpret_cast<_member_type<Is>*>(data + offset),
+            offset += _array_bytes<Is>(capacity)), ...);
+          if (_size)
+            (std::memcpy(std::get<Is>(members), std::get<Is>(_members),
+                         _size * sizeof(_member_type<Is>)), ...);
+        }(_member_idx_seq);
+        _deallocate();
+        _members = members;
+        _capacity = capacity;
+      }
+
+      void
+      _grow_to(size_type n)
+      {
+        if (n > _capacity)
+          _reallocate(std::max(n, 2 * _capacity));
+      }
+
+      T
+      _get(size_type i) const
+      {
+        T r {};
+        [&]<int... Is>(std::integer_sequence<int, Is...>) {
+          ((detail::flat_get<Is>(r) = std::get<Is>(_members)[i]), ...);
+        }(_member_idx_seq);
+        return r;
+      }
+
+      void
+      _set(size_type i, const T& x)
+      {
+        [&]<int... Is>(std::integer_sequence<int, Is...>) {
+          ((std::get<Is>(_members)[i] = detail::flat_get<Is>(x)), ...);
+        }(_member_idx_seq);
+      }
+
+      template <typename V, typename Flags>
+        VIR_ALWAYS_INLINE V
+        _load(size_type i, Flags f) const
+        {
+          V r;
+          [&]<int... Is>(std::integer_sequence<int, Is...>) {
+            ((detail::flat_get<Is>(r).copy_from(std::get<Is>(_members) + i, f)), ...);
+          }(_member_idx_seq);
+          return r;
+        }
+
+      template <typename V, typename Flags>
+        VIR_ALWAYS_INLINE void
+        _store(size_type i, const V& v, Flags f)
+        {
+          [&]<int... Is>(std::integer_sequence<int, Is...>) {
+            ((detail::flat_get<Is>(v).copy_to(std::get<Is>(_members) + i, f)), ...);
+          }(_member_idx_seq);
+        }
+
+      /// Whether loads of member \p I of `simdize<T, N>` at multiples of N are aligned.
+      template <int N, int I>
+        static constexpr bool _is_aligned_at_multiples = [] {
+          constexpr std::size_t a
+            = stdx::memory_alignment_v<detail::soa_member_t<I, vir::simdize<T, N>>>;
+          return a <= alignment and N * sizeof(_member_type<I>) % a == 0;
+        }();
+
+      /// vector_aligned if loads of `simdize<T, N>` at multiples of N are aligned.
+      template <int N>
+        static constexpr auto _simd_flags = [] {
+          if constexpr ([]<int... Is>(std::integer_sequence<int, Is...>) {
+                          return (_is_aligned_at_multiples<N, Is> and ...);
+                        }(_member_idx_seq))
+            return stdx::vector_aligned;
+          else
+            return stdx::element_aligned;
+        }();
+
+    public:
+      /// Proxy for the element at a given index. Converts to and is assignable from `T`.
+      class reference
+      {
+        friend soa_vector;
+
+        soa_vector* _vec;
+        size_type _index;
+
+        constexpr
+        reference(soa_vector* vec, size_type index) noexcept
+        : _vec(vec), _index(index)
+        {}
+
+      public:
+        reference(const reference&) = default;
+
+        operator T() const
+        { return _vec->_get(_index); }
+
+        const reference&
+        operator=(const T& x) const
+        {
+          _vec->_set(_index, x);
+          return *this;
+        }
+
+        const reference&
+        operator=(const reference& x) const
+        { return *this = T(x); }
+
+        /// The `I`-th flat data member of the element.
+        template <int I>
+          _member_type<I>&
+          member() const
+          { return std::get<I>(_vec->_members)[_index]; }
+      };
+
+      /**
+       * Random-access iterator over a soa_vector. Additionally loads and stores chunks of
+       * `vir::simdize<T, N>` via simd_load and simd_store, which the algorithms in
+       * vir/simd_execution.h use.
+       */
+      template <bool Const>
+        class basic_iterator
+        {
+          friend soa_vector;
+
+          template <bool>
+            friend class basic_iterator;
+
+          using _vec_ptr = std::conditional_t<Const, const soa_vector*, soa_vector*>;
+
+          _vec_ptr _vec = nullptr;
+          std::ptrdiff_t _index = 0;
+
+          constexpr
+          basic_iterator(_vec_ptr vec, std::ptrdiff_t index) noexcept
+          : _vec(vec), _index(index)
+          {}
+
+        public:
+          using value_type = T;
+          using difference_type = std::ptrdiff_t;
+          using reference = std::conditional_t<Const, T, typename soa_vector::reference>;
+          using iterator_concept = std::random_access_iterator_tag;
+          using iterator_category = std::input_iterator_tag;
+
+          basic_iterator() = default;
+
+          constexpr
+          basic_iterator(const basic_iterator<not Const>& it) noexcept requires Const
+          : _vec(it._vec), _index(it._index)
+          {}
+
+          /// The index of the element the iterator refers to.
+          constexpr size_type
+          index() const noexcept
+          { return _index; }
+
+          /// Loads the elements `[*this, *this + V::size())`. The load is aligned if the index is
+          /// a multiple of `V::size()` (as with simd_at), e.g. in the main loop of an algorithm
+          /// over `[begin(), end())`.
+          template <typename V>
+            requires std::same_as<V, vir::simdize<T, V::size()>>
+            VIR_ALWAYS_INLINE V
+            simd_load() const
+            {
+              if (_index % V::size() == 0)
+                return _vec->template _load<V>(_index, _simd_flags<V::size()>);
+              else
+                return _vec->template _load<V>(_index, stdx::element_aligned);
+            }
+
+          /// Stores \p v to the elements `[*this, *this + V::size())`, aligned under the same
+          /// condition as simd_load.
+          template <typename V>
+            requires (not Const) and std::same_as<V, vir::simdize<T, V::size()>>
+            VIR_ALWAYS_INLINE void
+            simd_store(const V& v) const
+            {
+              if (_index % V::size() == 0)
+                _vec->_store(_index, v, _simd_flags<V::size()>);
+              else
+                _vec->_store(_index, v, stdx::element_aligned);
+            }
+
+          reference
+          operator*() const
+          {
+            if constexpr (Const)
+              return _vec->_get(_index);
+            else
+              return {_vec, size_type(_index)};
+          }
+
+          reference
+          operator[](difference_type n) const
+          { return *(*this + n); }
+
+          constexpr basic_iterator&
+          operator++() noexcept
+          {
+            ++_index;
+            return *this;
+          }
+
+          constexpr basic_iterator
+          operator++(int) noexcept
+          {
+            basic_iterator tmp = *this;
+            ++_index;
+            return tmp;
+          }
+
+          constexpr basic_iterator&
+          operator--() noexcept
+          {
+            --_index;
+            return *this;
+          }
+
+          constexpr basic_iterator
+          operator--(int) noexcept
+          {
+            basic_iterator tmp = *this;
+            --_index;
+            return tmp;
+          }
+
+          constexpr basic_iterator&
+          operator+=(difference_type n) noexcept
+          {
+            _index += n;
+            return *this;
+          }
+
+          constexpr basic_iterator&
+          operator-=(difference_type n) noexcept
+          {
+            _index -= n;
+            return *this;
+          }
+
+          friend constexpr basic_iterator
+          operator+(basic_iterator it, difference_type n) noexcept
+          { return it += n; }
+
+          friend constexpr basic_iterator
+          operator+(difference_type n, basic_iterator it) noexcept
+          { return it += n; }
+
+          friend constexpr basic_iterator
+          operator-(basic_iterator it, difference_type n) noexcept
+          { return it -= n; }
+
+          friend constexpr difference_type
+          operator-(const basic_iterator& a, const basic_iterator& b) noexcept
+          { return a._index - b._index; }
+
+          friend constexpr bool
+          operator==(const basic_iterator& a, const basic_iterator& b) noexcept
+          { return a._index == b._index; }
+
+          friend constexpr auto
+          operator<=>(const basic_iterator& a, const basic_iterator& b) noexcept
+          { return a._index <=> b._index; }
+        };
+
+      using iterator = basic_iterator<false>;
+
+      using const_iterator = basic_iterator<true>;
+
+      soa_vector() = default;
+
+      /// Constructs \p n value-initialized elements.
+      explicit
+      soa_vector(size_type n)
+      { resize(n); }
+
+      /// Constructs \p n copies of \p value.
+      soa_vector(size_type n, const T& value)
+      { resize(n, value); }
+
+      soa_vector(std::initializer_list<T> init)
+      {
+        reserve(init.size());
+        for (const T& x : init)
+          push_back(x);
+      }
+
+      soa_vector(const soa_vector& rhs)
+      {
+        if (rhs._size)
+          {
+            _reallocate(rhs._size);
+            [&]<int... Is>(std::integer_sequence<int, Is...>) {
+              (std::memcpy(std::get<Is>(_members), std::get<Is>(rhs._members),
+                           rhs._size * sizeof(_member_type<Is>)), ...);
+            }(_member_idx_seq);
+            _size = rhs._size;
+          }
+      }
+
+      soa_vector(soa_vector&& rhs) noexcept
+      : _members(std::exchange(rhs._members, {})), _size(std::exchange(rhs._size, 0)),
+        _capacity(std::exchange(rhs._capacity, 0))
+      {}
+
+      soa_vector&
+      operator=(const soa_vector& rhs)
+      {
+        if (this != &rhs)
+          *this = soa_vector(rhs);
+        return *this;
+      }
+
+      soa_vector&
+      operator=(soa_vector&& rhs) noexcept
+      {
+        if (this != &rhs)
+          {
+            _deallocate();
+            _members = std::exchange(rhs._members, {});
+            _size = std::exchange(rhs._size, 0);
+            _capacity = std::exchange(rhs._capacity, 0);
+          }
+        return *this;
+      }
+
+      ~soa_vector()
+      { _deallocate(); }
+
+      size_type
+      size() const noexcept
+      { return _size; }
+
+      /// The number of elements that fit into the allocated arrays (a multiple of simd_size).
+      size_type
+      capacity() const noexcept
+      { return _capacity; }
+
+      bool
+      empty() const noexcept
+      { return _size == 0; }
+
+      void
+      reserve(size_type n)
+      {
+        if (n > _capacity)
+          _reallocate(n);
+      }
+
+      /// Appends \p x. Reallocates with amortized constant complexity.
+      void
+      push_back(const T& x)
+      {
+        _grow_to(_size + 1);
+        _set(_size, x);
+        ++_size;
+      }
+
+      void
+      pop_back() noexcept
+      { --_size; }
+
+      void
+      clear() noexcept
+      { _size = 0; }
+
+      /// Resizes to \p n elements. New elements are value-initialized.
+      void
+      resize(size_type n)
+      { resize(n, T()); }
+
+      /// Resizes to \p n elements. New elements are copies of \p value.
+      void
+      resize(size_type n, const T& value)
+      {
+        _grow_to(n);
+        for (size_type i = _size; i < n; ++i)
+          _set(i, value);
+        _size = n;
+      }
+
+      reference
+      operator[](size_type i) noexcept
+      { return {this, i}; }
+
+      const_reference
+      operator[](size_type i) const
+      { return _get(i); }
+
+      /// The array of the `I`-th flat data member of all elements.
+      template <int I>
+        std::span<_member_type<I>>
+        member() noexcept
+        { return {std::get<I>(_members), _size}; }
+
+      template <int I>
+        std::span<const _member_type<I>>
+        member() const noexcept
+        { return {std::get<I>(_members), _size}; }
+
+      /**
+       * Loads the elements `[i, i + N)` as a `vir::simdize<T, N>`, using aligned vector loads if
+       * `N` is a multiple of the vector size. Elements after `size()` have unspecified values.
+       *
+       * Precondition: `i` is a multiple of `N` and `i + N <= capacity()`.
+       */
+      template <int N = int(simd_size)>
+        VIR_ALWAYS_INLINE vir::simdize<T, N>
+        simd_at(size_type i) const
+        {
+          vir_simd_precondition(i % N == 0 and i + N <= _capacity,
+                                "simd_at requires an index that is a multiple of N");
+          return _load<vir::simdize<T, N>>(i, _simd_flags<N>);
+        }
+
+      /**
+       * Stores \p v to the elements `[i, i + V::size())`, the counterpart of simd_at.
+       *
+       * Precondition: `i` is a multiple of `V::size()` and `i + V::size() <= size()`.
+       */
+      template <typename V>
+        requires std::same_as<V, vir::simdize<T, V::size()>>
+        VIR_ALWAYS_INLINE void
+        simd_store(size_type i, const V& v)
+        {
+          vir_simd_precondition(i % V::size() == 0 and i + V::size() <= _size,
+                                "simd_store requires an index that is a multiple of V::size()");
+          _store(i, v, _simd_flags<V::size()>);
+        }
+
+      iterator
+      begin() noexcept
+      { return {this, 0}; }
+
+      const_iterator
+      begin() const noexcept
+      { return {this, 0}; }
+
+      const_iterator
+      cbegin() const noexcept
+      { return {this, 0}; }
+
+      iterator
+      end() noexcept
+      { return {this, difference_type(_size)}; }
+
+      const_iterator
+      end() const noexcept
+      { return {this, difference_type(_size)}; }
+
+      const_iterator
+      cend() const noexcept
+      { return {this, difference_type(_size)}; }
+    };
+} // namespace vir
+
+#endif // VIR_HAVE_SIMDIZE
+#endif // VIR_SOA_VECTOR_H_
+
+// vim: et cc=101 tw=100 sw=2 ts=8
@@ -10,6 +10,8 @@
 #include "simd_cvt.h"
 #include "simd_permute.h"
 #include "simd_execution.h"
+#include "aosoa_vector.h"
+#include "soa_vector.h"
 
 #include <complex>
 
@@ -188,6 +190,33 @@ static_assert(all_equal(vir::simd_permute<8>(short(2), [](unsigned i) {
 
 static_assert(all_equal(vir::simd_shift_in<1>(make_simd(0, 1, 2, 3), make_simd(4, 5, 6, 7)),
 			make_simd(1, 2, 3, 4)));
+
+static_assert([] {
+  constexpr short table[] = {10, 11, 12, 13, 14, 15, 16, 17};
+  return all_equal(vir::simd_gather(table, make_simd(7, 0, 3, 3)),
+		   make_simd<short>(17, 10, 13, 13));
+}());
+
+static_assert([] {
+  std::array<short, 8> data = {};
+  vir::simd_scatter(make_simd<short>(1, 2, 3, 4), data.data(), make_simd(6, 4, 2, 0));
+  return data == std::array<short, 8> {4, 0, 3, 0, 2, 0, 1, 0};
+}());
+
+#if SIMD_IS_CONSTEXPR_ENOUGH
+static_assert([] {
+  std::array<int, 4> data = {};
+  const auto v = make_simd(1, -2, 3, -4);
+  const int n = vir::compress_store(stdx::where(v > 0, v), data.data());
+  return n == 2 and data == std::array<int, 4> {1, 3, 0, 0};
+}());
+
+static_assert([] {
+  constexpr int data[] = {5, 6};
+  return all_equal(vir::expand_load(make_simd(1, -2, 3, -4) < 0, data),
+		   make_simd(0, 5, 0, 6));
+}());
+#endif
 #endif // VIR_HAVE_SIMD_PERMUTE
 
 #if VIR_HAVE_STRUCT_REFLECT
@@ -500,6 +529,109 @@ static_assert(std::same_as<vir::as_tuple_t<Line>,
 static_assert(std::same_as<vir::simdize<Line>,
 			   vir::simd_tuple<Line, V<float>::size()>>);
 
+struct LineWidth
+{
+  Line line;
+  short width;
+};
+
+static_assert(vir::detail::flat_member_count_v<LineWidth> == 7);
+static_assert([] {
+  LineWidth l = {};
+  vir::detail::flat_get<4>(l) = 1.f;
+  vir::detail::flat_get<6>(l) = 2;
+  return l.line.b.y == 1.f and l.width == 2;
+}());
+
+template <typename T>
+struct Vec2
+{
+  T x, y;
+};
+
+template <typename T>
+  inline constexpr bool vir::enable_simdize_operators<Vec2<T>> = true;
+
+template <>
+  inline constexpr bool vir::enable_simdize_operators<Line> = true;
+
+static_assert(std::same_as<vir::simdize<Vec2<float>>,
+			   vir::vectorized_struct<Vec2<float>, V<float>::size()>>);
+
+template <typename V>
+  concept has_plus = requires(V a) { a + a; };
+
+template <typename V>
+  concept has_equal_to = requires(V a) { a == a; };
+
+template <typename V>
+  concept has_masked_plus_assign = requires(V a, typename V::mask_type k) {
+    vir::where(k, a) += a;
+  };
+
+// member-wise operators are opt-in
+static_assert(not has_plus<vir::simdize<LineWidth>>);
+static_assert(not has_equal_to<vir::simdize<LineWidth>>);
+static_assert(not has_masked_plus_assign<vir::simdize<LineWidth>>);
+static_assert(requires(vir::simdize<LineWidth> a, vir::simdize<LineWidth>::mask_type k) {
+  vir::where(k, a) = a;
+  { vir::select(k, a, a) } -> std::same_as<vir::simdize<LineWidth>>;
+});
+
+static_assert(requires(vir::simdize<Line> a) {
+  { a + a } -> std::same_as<vir::simdize<Line>>;
+  { a / a } -> std::same_as<vir::simdize<Line>>;
+  { a -= a } -> std::same_as<vir::simdize<Line>&>;
+  { a < a } -> std::same_as<vir::simdize<Line>::mask_type>;
+  { a != a } -> std::same_as<vir::simdize<Line>::mask_type>;
+  vir::where(a == a, a) *= a;
+});
+
+static_assert(requires(vir::simdize<Vec2<float>> a) {
+  { a * a } -> std::same_as<vir::simdize<Vec2<float>>>;
+  { a + Vec2<float>{1.f, 2.f} } -> std::same_as<vir::simdize<Vec2<float>>>;
+  { a >= a } -> std::same_as<vir::simdize<Vec2<float>>::mask_type>;
+  vir::where(a == a, a) -= a;
+});
+
+#if SIMD_IS_CONSTEXPR_ENOUGH
+static_assert([] {
+  using VV = vir::simdize<Vec2<float>>;
+  const VV a {V<float>([](short i) { return i; }), 1.f};
+  const VV b = Vec2<float> {1.f, 2.f};
+  VV c = a + b;
+  if (any_of(c.x != a.x + 1.f) or any_of(c.y != 3.f))
+    return false;
+  c -= b;
+  if (not all_of(c == a) or any_of(c != a))
+    return false;
+  if (any_of(a >= b) or not all_of(a * b <= VV(Vec2<float> {V<float>::size() - 1.f, 2.f})))
+    return false;
+  // the conjunction of member-wise comparisons
+  const VV d {V<float>([](short i) { return i; }), V<float>([](short i) { return 1 - i; })};
+  if (not all_of((d == a) == (a.x == 0.f)))
+    return false;
+  c = vir::select(a.x < 2.f, a, b);
+  const V<float> x_ref([](short i) { return i < 1 ? i : 1; });
+  if (not all_of(c.x == x_ref) or not all_of((c.y == 1.f) == (a.x < 2.f)))
+    return false;
+  vir::where(a.x >= 2.f, c) /= b;
+  return all_of(c.x == x_ref) and all_of(c.y == 1.f);
+}());
+
+static_assert([] {
+  using VL = vir::simdize<Line>;
+  const VL a = Line {{1.f, 2.f, 3.f}, {4.f, 5.f, 6.f}};
+  VL b = a + a;
+  if (not all_of(vir::get<1>(b).z == 12.f) or not all_of(b > a))
+    return false;
+  vir::where(vir::get<0>(b).x > 100.f, b) = a;
+  if (not all_of(b == a + a))
+    return false;
+  return all_of(vir::select(vir::get<0>(b).x == 2.f, a, b) == a);
+}());
+#endif
+
 #if VIR_HAVE_SIMD_IOTA
 constexpr vir::simdize<Point> point{vir::iota_v<V<float>>, 2.f, 3.f};
 static_assert(point[0].x == 0.f);